@@ -0,0 +1,108 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Release".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "MADmuparser" for configuration "Release"
+set_property(TARGET MADmuparser APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(MADmuparser PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libMADmuparser.so"
+  IMPORTED_SONAME_RELEASE "libMADmuparser.so"
+  )
+
+list(APPEND _cmake_import_check_targets MADmuparser )
+list(APPEND _cmake_import_check_files_for_MADmuparser "${_IMPORT_PREFIX}/lib/libMADmuparser.so" )
+
+# Import target "MADtinyxml" for configuration "Release"
+set_property(TARGET MADtinyxml APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(MADtinyxml PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libMADtinyxml.so"
+  IMPORTED_SONAME_RELEASE "libMADtinyxml.so"
+  )
+
+list(APPEND _cmake_import_check_targets MADtinyxml )
+list(APPEND _cmake_import_check_files_for_MADtinyxml "${_IMPORT_PREFIX}/lib/libMADtinyxml.so" )
+
+# Import target "MADworld" for configuration "Release"
+set_property(TARGET MADworld APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(MADworld PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libMADworld.so"
+  IMPORTED_SONAME_RELEASE "libMADworld.so"
+  )
+
+list(APPEND _cmake_import_check_targets MADworld )
+list(APPEND _cmake_import_check_files_for_MADworld "${_IMPORT_PREFIX}/lib/libMADworld.so" )
+
+# Import target "MADmisc" for configuration "Release"
+set_property(TARGET MADmisc APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(MADmisc PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libMADmisc.so"
+  IMPORTED_SONAME_RELEASE "libMADmisc.so"
+  )
+
+list(APPEND _cmake_import_check_targets MADmisc )
+list(APPEND _cmake_import_check_files_for_MADmisc "${_IMPORT_PREFIX}/lib/libMADmisc.so" )
+
+# Import target "MADtensor" for configuration "Release"
+set_property(TARGET MADtensor APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(MADtensor PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libMADtensor.so"
+  IMPORTED_SONAME_RELEASE "libMADtensor.so"
+  )
+
+list(APPEND _cmake_import_check_targets MADtensor )
+list(APPEND _cmake_import_check_files_for_MADtensor "${_IMPORT_PREFIX}/lib/libMADtensor.so" )
+
+# Import target "MADlinalg" for configuration "Release"
+set_property(TARGET MADlinalg APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(MADlinalg PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libMADlinalg.so"
+  IMPORTED_SONAME_RELEASE "libMADlinalg.so"
+  )
+
+list(APPEND _cmake_import_check_targets MADlinalg )
+list(APPEND _cmake_import_check_files_for_MADlinalg "${_IMPORT_PREFIX}/lib/libMADlinalg.so" )
+
+# Import target "MADmra" for configuration "Release"
+set_property(TARGET MADmra APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(MADmra PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libMADmra.so"
+  IMPORTED_SONAME_RELEASE "libMADmra.so"
+  )
+
+list(APPEND _cmake_import_check_targets MADmra )
+list(APPEND _cmake_import_check_files_for_MADmra "${_IMPORT_PREFIX}/lib/libMADmra.so" )
+
+# Import target "mraplot" for configuration "Release"
+set_property(TARGET mraplot APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(mraplot PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/bin/mraplot"
+  )
+
+list(APPEND _cmake_import_check_targets mraplot )
+list(APPEND _cmake_import_check_files_for_mraplot "${_IMPORT_PREFIX}/bin/mraplot" )
+
+# Import target "madness" for configuration "Release"
+set_property(TARGET madness APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(madness PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libmadness.so"
+  IMPORTED_SONAME_RELEASE "libmadness.so"
+  )
+
+list(APPEND _cmake_import_check_targets madness )
+list(APPEND _cmake_import_check_files_for_madness "${_IMPORT_PREFIX}/lib/libmadness.so" )
+
+# Import target "MADchem" for configuration "Release"
+set_property(TARGET MADchem APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(MADchem PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libMADchem.so"
+  IMPORTED_SONAME_RELEASE "libMADchem.so"
+  )
+
+list(APPEND _cmake_import_check_targets MADchem )
+list(APPEND _cmake_import_check_files_for_MADchem "${_IMPORT_PREFIX}/lib/libMADchem.so" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
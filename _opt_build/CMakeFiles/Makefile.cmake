@@ -0,0 +1,298 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeASMCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/config.h.in"
+  "/root/repo/cmake/doxygen.cfg.in"
+  "/root/repo/cmake/madness-config.cmake.in"
+  "/root/repo/cmake/modules/AddMADLibrary.cmake"
+  "/root/repo/cmake/modules/AddUnittests.cmake"
+  "/root/repo/cmake/modules/AppendFlags.cmake"
+  "/root/repo/cmake/modules/CheckCFortranFunctionExists.cmake"
+  "/root/repo/cmake/modules/CheckCXX11Support.cmake"
+  "/root/repo/cmake/modules/CopyTargetProperties.cmake"
+  "/root/repo/cmake/modules/FindACML.cmake"
+  "/root/repo/cmake/modules/FindLibunwind.cmake"
+  "/root/repo/cmake/modules/FindLibxc.cmake"
+  "/root/repo/doc/CMakeLists.txt"
+  "/root/repo/external/gperftools.cmake"
+  "/root/repo/external/lapack.cmake"
+  "/root/repo/external/libunwind.cmake"
+  "/root/repo/external/libxc.cmake"
+  "/root/repo/external/mpi.cmake"
+  "/root/repo/external/papi.cmake"
+  "/root/repo/external/pthread.cmake"
+  "/root/repo/external/tbb.cmake"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/apps/CMakeLists.txt"
+  "/root/repo/src/apps/chem/CMakeLists.txt"
+  "/root/repo/src/apps/moldft/CMakeLists.txt"
+  "/root/repo/src/apps/tdse/CMakeLists.txt"
+  "/root/repo/src/examples/CMakeLists.txt"
+  "/root/repo/src/madness/CMakeLists.txt"
+  "/root/repo/src/madness/external/CMakeLists.txt"
+  "/root/repo/src/madness/external/gtest/CMakeLists.txt"
+  "/root/repo/src/madness/external/muParser/CMakeLists.txt"
+  "/root/repo/src/madness/external/tinyxml/CMakeLists.txt"
+  "/root/repo/src/madness/misc/CMakeLists.txt"
+  "/root/repo/src/madness/mra/CMakeLists.txt"
+  "/root/repo/src/madness/tensor/CMakeLists.txt"
+  "/root/repo/src/madness/world/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeASMInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePushCheckState.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-ASM.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindDoxygen.cmake"
+  "/usr/share/cmake-3.25/Modules/FindLATEX.cmake"
+  "/usr/share/cmake-3.25/Modules/FindMPI.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPythonInterp.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "src/madness/config.h"
+  "doc/doxygen.cfg"
+  "madness-config-version.cmake"
+  "madness-config.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/madness/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/madness/external/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/madness/external/gtest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/madness/external/muParser/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/madness/external/tinyxml/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/madness/world/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/madness/misc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/madness/tensor/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/madness/mra/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/apps/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/apps/chem/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/apps/tdse/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/apps/moldft/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "doc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/libraries.dir/DependInfo.cmake"
+  "CMakeFiles/install-libraries.dir/DependInfo.cmake"
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.dir/DependInfo.cmake"
+  "CMakeFiles/check.dir/DependInfo.cmake"
+  "src/madness/CMakeFiles/madness.dir/DependInfo.cmake"
+  "src/madness/CMakeFiles/install-common.dir/DependInfo.cmake"
+  "src/madness/external/gtest/CMakeFiles/MADgtest.dir/DependInfo.cmake"
+  "src/madness/external/muParser/CMakeFiles/MADmuparser-obj.dir/DependInfo.cmake"
+  "src/madness/external/muParser/CMakeFiles/MADmuparser.dir/DependInfo.cmake"
+  "src/madness/external/muParser/CMakeFiles/install-muparser.dir/DependInfo.cmake"
+  "src/madness/external/tinyxml/CMakeFiles/MADtinyxml-obj.dir/DependInfo.cmake"
+  "src/madness/external/tinyxml/CMakeFiles/MADtinyxml.dir/DependInfo.cmake"
+  "src/madness/external/tinyxml/CMakeFiles/install-tinyxml.dir/DependInfo.cmake"
+  "src/madness/world/CMakeFiles/MADworld-obj.dir/DependInfo.cmake"
+  "src/madness/world/CMakeFiles/MADworld.dir/DependInfo.cmake"
+  "src/madness/world/CMakeFiles/install-world.dir/DependInfo.cmake"
+  "src/madness/world/CMakeFiles/world_unittests.dir/DependInfo.cmake"
+  "src/madness/world/CMakeFiles/test_prof.dir/DependInfo.cmake"
+  "src/madness/world/CMakeFiles/test_ar.dir/DependInfo.cmake"
+  "src/madness/world/CMakeFiles/test_hashdc.dir/DependInfo.cmake"
+  "src/madness/world/CMakeFiles/test_hello.dir/DependInfo.cmake"
+  "src/madness/world/CMakeFiles/test_atomicint.dir/DependInfo.cmake"
+  "src/madness/world/CMakeFiles/test_future.dir/DependInfo.cmake"
+  "src/madness/world/CMakeFiles/test_future2.dir/DependInfo.cmake"
+  "src/madness/world/CMakeFiles/test_future3.dir/DependInfo.cmake"
+  "src/madness/world/CMakeFiles/test_dc.dir/DependInfo.cmake"
+  "src/madness/world/CMakeFiles/test_hashthreaded.dir/DependInfo.cmake"
+  "src/madness/world/CMakeFiles/test_queue.dir/DependInfo.cmake"
+  "src/madness/world/CMakeFiles/test_world.dir/DependInfo.cmake"
+  "src/madness/world/CMakeFiles/test_worldprofile.dir/DependInfo.cmake"
+  "src/madness/world/CMakeFiles/test_binsorter.dir/DependInfo.cmake"
+  "src/madness/world/CMakeFiles/test_vector.dir/DependInfo.cmake"
+  "src/madness/world/CMakeFiles/test_worldptr.dir/DependInfo.cmake"
+  "src/madness/world/CMakeFiles/test_worldref.dir/DependInfo.cmake"
+  "src/madness/world/CMakeFiles/test_stack.dir/DependInfo.cmake"
+  "src/madness/world/CMakeFiles/test_googletest.dir/DependInfo.cmake"
+  "src/madness/misc/CMakeFiles/MADmisc-obj.dir/DependInfo.cmake"
+  "src/madness/misc/CMakeFiles/MADmisc.dir/DependInfo.cmake"
+  "src/madness/misc/CMakeFiles/install-misc.dir/DependInfo.cmake"
+  "src/madness/misc/CMakeFiles/misc_unittests.dir/DependInfo.cmake"
+  "src/madness/misc/CMakeFiles/interp3.dir/DependInfo.cmake"
+  "src/madness/tensor/CMakeFiles/MADtensor-obj.dir/DependInfo.cmake"
+  "src/madness/tensor/CMakeFiles/MADtensor.dir/DependInfo.cmake"
+  "src/madness/tensor/CMakeFiles/install-tensor.dir/DependInfo.cmake"
+  "src/madness/tensor/CMakeFiles/MADlinalg-obj.dir/DependInfo.cmake"
+  "src/madness/tensor/CMakeFiles/MADlinalg.dir/DependInfo.cmake"
+  "src/madness/tensor/CMakeFiles/install-linalg.dir/DependInfo.cmake"
+  "src/madness/tensor/CMakeFiles/tensor_unittests.dir/DependInfo.cmake"
+  "src/madness/tensor/CMakeFiles/test_tensor.dir/DependInfo.cmake"
+  "src/madness/tensor/CMakeFiles/oldtest.dir/DependInfo.cmake"
+  "src/madness/tensor/CMakeFiles/test_scott.dir/DependInfo.cmake"
+  "src/madness/tensor/CMakeFiles/test_mtxmq.dir/DependInfo.cmake"
+  "src/madness/tensor/CMakeFiles/jimkernel.dir/DependInfo.cmake"
+  "src/madness/tensor/CMakeFiles/test_distributed_matrix.dir/DependInfo.cmake"
+  "src/madness/tensor/CMakeFiles/test_Zmtxmq.dir/DependInfo.cmake"
+  "src/madness/tensor/CMakeFiles/test_systolic.dir/DependInfo.cmake"
+  "src/madness/tensor/CMakeFiles/linalg_unittests.dir/DependInfo.cmake"
+  "src/madness/tensor/CMakeFiles/test_linalg.dir/DependInfo.cmake"
+  "src/madness/tensor/CMakeFiles/test_solvers.dir/DependInfo.cmake"
+  "src/madness/tensor/CMakeFiles/testseprep.dir/DependInfo.cmake"
+  "src/madness/tensor/CMakeFiles/bench_mtxmq.dir/DependInfo.cmake"
+  "src/madness/tensor/CMakeFiles/bench_transform.dir/DependInfo.cmake"
+  "src/madness/mra/CMakeFiles/MADmra-obj.dir/DependInfo.cmake"
+  "src/madness/mra/CMakeFiles/MADmra.dir/DependInfo.cmake"
+  "src/madness/mra/CMakeFiles/install-mra.dir/DependInfo.cmake"
+  "src/madness/mra/CMakeFiles/mraplot.dir/DependInfo.cmake"
+  "src/madness/mra/CMakeFiles/libtest_sepop.dir/DependInfo.cmake"
+  "src/madness/mra/CMakeFiles/mra_unittests.dir/DependInfo.cmake"
+  "src/madness/mra/CMakeFiles/testbsh.dir/DependInfo.cmake"
+  "src/madness/mra/CMakeFiles/testproj.dir/DependInfo.cmake"
+  "src/madness/mra/CMakeFiles/testpdiff.dir/DependInfo.cmake"
+  "src/madness/mra/CMakeFiles/testdiff1Db.dir/DependInfo.cmake"
+  "src/madness/mra/CMakeFiles/testgconv.dir/DependInfo.cmake"
+  "src/madness/mra/CMakeFiles/testopdir.dir/DependInfo.cmake"
+  "src/madness/mra/CMakeFiles/testinnerext.dir/DependInfo.cmake"
+  "src/madness/mra/CMakeFiles/testgaxpyext.dir/DependInfo.cmake"
+  "src/madness/mra/CMakeFiles/testvmra.dir/DependInfo.cmake"
+  "src/madness/mra/CMakeFiles/mra_sepop_unittests.dir/DependInfo.cmake"
+  "src/madness/mra/CMakeFiles/testsuite.dir/DependInfo.cmake"
+  "src/madness/mra/CMakeFiles/testper.dir/DependInfo.cmake"
+  "src/madness/mra/CMakeFiles/testperiodic.dir/DependInfo.cmake"
+  "src/madness/mra/CMakeFiles/testbc.dir/DependInfo.cmake"
+  "src/madness/mra/CMakeFiles/testqm.dir/DependInfo.cmake"
+  "src/madness/mra/CMakeFiles/test6.dir/DependInfo.cmake"
+  "src/madness/mra/CMakeFiles/testdiff1D.dir/DependInfo.cmake"
+  "src/madness/mra/CMakeFiles/testdiff2D.dir/DependInfo.cmake"
+  "src/madness/mra/CMakeFiles/testdiff3D.dir/DependInfo.cmake"
+  "src/apps/chem/CMakeFiles/MADchem-obj.dir/DependInfo.cmake"
+  "src/apps/chem/CMakeFiles/MADchem.dir/DependInfo.cmake"
+  "src/apps/chem/CMakeFiles/install-chem.dir/DependInfo.cmake"
+  "src/apps/chem/CMakeFiles/plotxc.dir/DependInfo.cmake"
+  "src/apps/chem/CMakeFiles/chem_unittests.dir/DependInfo.cmake"
+  "src/apps/chem/CMakeFiles/test_SCFOperators.dir/DependInfo.cmake"
+  "src/apps/chem/CMakeFiles/test_dft.dir/DependInfo.cmake"
+  "src/apps/chem/CMakeFiles/testxc.dir/DependInfo.cmake"
+  "src/apps/tdse/CMakeFiles/tdse.dir/DependInfo.cmake"
+  "src/apps/tdse/CMakeFiles/tdse4.dir/DependInfo.cmake"
+  "src/apps/moldft/CMakeFiles/moldft.dir/DependInfo.cmake"
+  "src/apps/moldft/CMakeFiles/mcpfit.dir/DependInfo.cmake"
+  "src/apps/moldft/CMakeFiles/testpg.dir/DependInfo.cmake"
+  "src/apps/moldft/CMakeFiles/testperiodic_moldft.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/pno.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/h2dft.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/hedft.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/hello.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/hatom_energy.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/h2.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/he.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/tdse_example.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/heat.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/heat2.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/csqrt.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/sdf_shape_tester.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/test_gmres.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/tdse1d.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/vnucso.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/nonlinschro.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/sininteg.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/functionio.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/dataloadbal.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/hatom_1d.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/binaryop.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/dielectric.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/hehf.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/3dharmonic.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/testsolver.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/testspectralprop.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/dielectric_external_field.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/mp2.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/tiny.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/oep.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/h2dynamic.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/newsolver.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/tdhf.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/cc2.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/nemo.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/helium_exact.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/density_smoothing.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/siam_example.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,87 @@
+# - CMAKE Config file for the MADNESS package
+# The following variables are defined:
+#  Madness_INCLUDE_DIRS         - The MADNESS include directory
+#  Madness_LIBRARIES            - The MADNESS libraries and their dependencies
+#  Madness_<COMPONENT>_FOUND    - System has the specified MADNESS COMPONENT
+#  Madness_<COMPONENT>_LIBRARY  - The MADNESS COMPONENT library
+#  Madness_F77_INTEGER_SIZE     - The default F77 integer size used for BLAS calls 
+
+# Set package version
+set(Madness_VERSION "0.10.0")
+
+
+####### Expanded from @PACKAGE_INIT@ by configure_package_config_file() #######
+####### Any changes to this file will be overwritten by the next CMake run ####
+####### The input file was madness-config.cmake.in                            ########
+
+get_filename_component(PACKAGE_PREFIX_DIR "${CMAKE_CURRENT_LIST_DIR}/../../../" ABSOLUTE)
+
+macro(set_and_check _var _file)
+  set(${_var} "${_file}")
+  if(NOT EXISTS "${_file}")
+    message(FATAL_ERROR "File or directory ${_file} referenced by variable ${_var} does not exist !")
+  endif()
+endmacro()
+
+macro(check_required_components _NAME)
+  foreach(comp ${${_NAME}_FIND_COMPONENTS})
+    if(NOT ${_NAME}_${comp}_FOUND)
+      if(${_NAME}_FIND_REQUIRED_${comp})
+        set(${_NAME}_FOUND FALSE)
+      endif()
+    endif()
+  endforeach()
+endmacro()
+
+####################################################################################
+
+# Include library IMPORT targets
+if(NOT TARGET madness)
+  include("${CMAKE_CURRENT_LIST_DIR}/madness-targets.cmake")
+endif()
+
+# Set the madness libraries target
+set(Madness_LIBRARIES madness)
+
+set(MADNESS_SOURCE_DIR "/root/repo")
+set(MADNESS_BINARY_DIR "/root/repo/_opt_build")
+
+# Set Elemental variables
+set(ENABLE_ELEMENTAL OFF)
+
+if(CMAKE_CURRENT_LIST_DIR EQUAL MADNESS_BINARY_DIR)
+  # In build tree
+  
+  set(Elemental_SOURCE_DIR "")
+  set(Elemental_BINARY_DIR "")
+  
+  set(Madness_INCLUDE_DIRS "${MADNESS_SOURCE_DIR}/src" "${MADNESS_BINARY_DIR}/src")
+  if(ENABLE_ELEMENTAL)
+    list(APPEND Madness_INCLUDE_DIRS 
+        "${Elemental_SOURCE_DIR}/include" "${Elemental_BINARY_DIR}/include"
+        "${Elemental_SOURCE_DIR}/external/pmrrr/include"
+        "${Elemental_BINARY_DIR}/external/pmrrr/include")
+  endif()
+else()
+  # In install tree
+  
+  list(APPEND Madness_INCLUDE_DIRS "${PACKAGE_PREFIX_DIR}/include"
+      "${PACKAGE_PREFIX_DIR}/include/madness/external")
+endif()
+
+# Set component variables
+foreach(_comp world misc tensor linalg tinyxml muparser mra chem)
+  if(TARGET MAD${_comp})
+    set(Madness_${_comp}_FOUND TRUE)
+    set(Madness_${_comp}_LIBRARY ${_comp})
+  else()
+    set(Madness_${_comp}_FOUND FALSE)
+    set(Madness_${_comp}_LIBRARY "Madness_${_comp}_LIBRARY-NOTFOUND")
+  endif()
+endforeach()
+
+# Set the Fortran 77 integer size (4 or 8)
+set(Madness_F77_INTEGER_SIZE 4)
+
+check_required_components(Madness)
+
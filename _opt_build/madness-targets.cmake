@@ -0,0 +1,208 @@
+# Generated by CMake
+
+if("${CMAKE_MAJOR_VERSION}.${CMAKE_MINOR_VERSION}" LESS 2.8)
+   message(FATAL_ERROR "CMake >= 2.8.0 required")
+endif()
+if(CMAKE_VERSION VERSION_LESS "2.8.3")
+   message(FATAL_ERROR "CMake >= 2.8.3 required")
+endif()
+cmake_policy(PUSH)
+cmake_policy(VERSION 2.8.3...3.23)
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Protect against multiple inclusion, which would fail when already imported targets are added once more.
+set(_cmake_targets_defined "")
+set(_cmake_targets_not_defined "")
+set(_cmake_expected_targets "")
+foreach(_cmake_expected_target IN ITEMS MADmuparser MADtinyxml MADworld MADmisc MADtensor MADlinalg MADmra mraplot madness MADchem)
+  list(APPEND _cmake_expected_targets "${_cmake_expected_target}")
+  if(TARGET "${_cmake_expected_target}")
+    list(APPEND _cmake_targets_defined "${_cmake_expected_target}")
+  else()
+    list(APPEND _cmake_targets_not_defined "${_cmake_expected_target}")
+  endif()
+endforeach()
+unset(_cmake_expected_target)
+if(_cmake_targets_defined STREQUAL _cmake_expected_targets)
+  unset(_cmake_targets_defined)
+  unset(_cmake_targets_not_defined)
+  unset(_cmake_expected_targets)
+  unset(CMAKE_IMPORT_FILE_VERSION)
+  cmake_policy(POP)
+  return()
+endif()
+if(NOT _cmake_targets_defined STREQUAL "")
+  string(REPLACE ";" ", " _cmake_targets_defined_text "${_cmake_targets_defined}")
+  string(REPLACE ";" ", " _cmake_targets_not_defined_text "${_cmake_targets_not_defined}")
+  message(FATAL_ERROR "Some (but not all) targets in this export set were already defined.\nTargets Defined: ${_cmake_targets_defined_text}\nTargets not yet defined: ${_cmake_targets_not_defined_text}\n")
+endif()
+unset(_cmake_targets_defined)
+unset(_cmake_targets_not_defined)
+unset(_cmake_expected_targets)
+
+
+# Create imported target MADmuparser
+add_library(MADmuparser SHARED IMPORTED)
+
+set_target_properties(MADmuparser PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/_opt_build/src/madness/external/muParser;/root/repo/src/madness/external/muParser"
+)
+
+# Create imported target MADtinyxml
+add_library(MADtinyxml SHARED IMPORTED)
+
+set_target_properties(MADtinyxml PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/_opt_build/src/madness/external/tinyxml;/root/repo/src/madness/external/tinyxml"
+)
+
+# Create imported target MADworld
+add_library(MADworld SHARED IMPORTED)
+
+set_target_properties(MADworld PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "MPICH_SKIP_MPICXX=1;OMPI_SKIP_MPICXX=1"
+  INTERFACE_INCLUDE_DIRECTORIES "/usr/lib/x86_64-linux-gnu/openmpi/include;/usr/lib/x86_64-linux-gnu/openmpi/include/openmpi;/root/repo/_opt_build/src/madness/world;/root/repo/src/madness/world"
+  INTERFACE_LINK_LIBRARIES "/usr/lib/x86_64-linux-gnu/openmpi/lib/libmpi.so"
+)
+
+# Create imported target MADmisc
+add_library(MADmisc SHARED IMPORTED)
+
+set_target_properties(MADmisc PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "\$<TARGET_PROPERTY:MADworld,INTERFACE_COMPILE_DEFINITIONS>"
+  INTERFACE_COMPILE_OPTIONS "\$<TARGET_PROPERTY:MADworld,INTERFACE_COMPILE_OPTIONS>"
+  INTERFACE_INCLUDE_DIRECTORIES "\$<TARGET_PROPERTY:MADworld,INTERFACE_INCLUDE_DIRECTORIES>;/root/repo/_opt_build/src/madness/misc;/root/repo/src/madness/misc"
+  INTERFACE_LINK_LIBRARIES "MADworld"
+)
+
+# Create imported target MADtensor
+add_library(MADtensor SHARED IMPORTED)
+
+set_target_properties(MADtensor PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "\$<TARGET_PROPERTY:MADmisc,INTERFACE_COMPILE_DEFINITIONS>"
+  INTERFACE_COMPILE_OPTIONS "\$<TARGET_PROPERTY:MADmisc,INTERFACE_COMPILE_OPTIONS>"
+  INTERFACE_INCLUDE_DIRECTORIES "\$<TARGET_PROPERTY:MADmisc,INTERFACE_INCLUDE_DIRECTORIES>;/root/repo/_opt_build/src/madness/tensor;/root/repo/src/madness/tensor"
+  INTERFACE_LINK_LIBRARIES "MADmisc"
+)
+
+# Create imported target MADlinalg
+add_library(MADlinalg SHARED IMPORTED)
+
+set_target_properties(MADlinalg PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "\$<TARGET_PROPERTY:MADtensor,INTERFACE_COMPILE_DEFINITIONS>"
+  INTERFACE_COMPILE_OPTIONS "\$<TARGET_PROPERTY:MADtensor,INTERFACE_COMPILE_OPTIONS>"
+  INTERFACE_INCLUDE_DIRECTORIES "\$<TARGET_PROPERTY:MADtensor,INTERFACE_INCLUDE_DIRECTORIES>;/root/repo/_opt_build/src/madness/tensor;/root/repo/src/madness/tensor"
+  INTERFACE_LINK_LIBRARIES "MADtensor;/usr/lib/x86_64-linux-gnu/liblapack.so;/usr/lib/x86_64-linux-gnu/libblas.so"
+)
+
+# Create imported target MADmra
+add_library(MADmra SHARED IMPORTED)
+
+set_target_properties(MADmra PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "\$<TARGET_PROPERTY:MADlinalg,INTERFACE_COMPILE_DEFINITIONS>;\$<TARGET_PROPERTY:MADtinyxml,INTERFACE_COMPILE_DEFINITIONS>;\$<TARGET_PROPERTY:MADmuparser,INTERFACE_COMPILE_DEFINITIONS>"
+  INTERFACE_COMPILE_OPTIONS "\$<TARGET_PROPERTY:MADlinalg,INTERFACE_COMPILE_OPTIONS>;\$<TARGET_PROPERTY:MADtinyxml,INTERFACE_COMPILE_OPTIONS>;\$<TARGET_PROPERTY:MADmuparser,INTERFACE_COMPILE_OPTIONS>"
+  INTERFACE_INCLUDE_DIRECTORIES "\$<TARGET_PROPERTY:MADlinalg,INTERFACE_INCLUDE_DIRECTORIES>;\$<TARGET_PROPERTY:MADtinyxml,INTERFACE_INCLUDE_DIRECTORIES>;\$<TARGET_PROPERTY:MADmuparser,INTERFACE_INCLUDE_DIRECTORIES>;/root/repo/_opt_build/src/madness/mra;/root/repo/src/madness/mra"
+  INTERFACE_LINK_LIBRARIES "MADlinalg;MADtinyxml;MADmuparser"
+)
+
+# Create imported target mraplot
+add_executable(mraplot IMPORTED)
+
+# Create imported target madness
+add_library(madness SHARED IMPORTED)
+
+set_target_properties(madness PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "MPICH_SKIP_MPICXX=1;OMPI_SKIP_MPICXX=1"
+  INTERFACE_INCLUDE_DIRECTORIES "/usr/lib/x86_64-linux-gnu/openmpi/include;/usr/lib/x86_64-linux-gnu/openmpi/include/openmpi;/root/repo/_opt_build/src/madness;/root/repo/src/madness"
+  INTERFACE_LINK_LIBRARIES "/usr/lib/x86_64-linux-gnu/openmpi/lib/libmpi.so;/usr/lib/x86_64-linux-gnu/liblapack.so;/usr/lib/x86_64-linux-gnu/libblas.so"
+)
+
+# Create imported target MADchem
+add_library(MADchem SHARED IMPORTED)
+
+set_target_properties(MADchem PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "\$<TARGET_PROPERTY:MADmra,INTERFACE_COMPILE_DEFINITIONS>"
+  INTERFACE_COMPILE_OPTIONS "\$<TARGET_PROPERTY:MADmra,INTERFACE_COMPILE_OPTIONS>"
+  INTERFACE_INCLUDE_DIRECTORIES "\$<TARGET_PROPERTY:MADmra,INTERFACE_INCLUDE_DIRECTORIES>;/root/repo/_opt_build/src/apps/chem;/root/repo/src/apps/chem"
+  INTERFACE_LINK_LIBRARIES "MADmra"
+)
+
+# Import target "MADmuparser" for configuration "Release"
+set_property(TARGET MADmuparser APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(MADmuparser PROPERTIES
+  IMPORTED_LOCATION_RELEASE "/root/repo/_opt_build/src/madness/external/muParser/libMADmuparser.so"
+  IMPORTED_SONAME_RELEASE "libMADmuparser.so"
+  )
+
+# Import target "MADtinyxml" for configuration "Release"
+set_property(TARGET MADtinyxml APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(MADtinyxml PROPERTIES
+  IMPORTED_LOCATION_RELEASE "/root/repo/_opt_build/src/madness/external/tinyxml/libMADtinyxml.so"
+  IMPORTED_SONAME_RELEASE "libMADtinyxml.so"
+  )
+
+# Import target "MADworld" for configuration "Release"
+set_property(TARGET MADworld APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(MADworld PROPERTIES
+  IMPORTED_LOCATION_RELEASE "/root/repo/_opt_build/src/madness/world/libMADworld.so"
+  IMPORTED_SONAME_RELEASE "libMADworld.so"
+  )
+
+# Import target "MADmisc" for configuration "Release"
+set_property(TARGET MADmisc APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(MADmisc PROPERTIES
+  IMPORTED_LOCATION_RELEASE "/root/repo/_opt_build/src/madness/misc/libMADmisc.so"
+  IMPORTED_SONAME_RELEASE "libMADmisc.so"
+  )
+
+# Import target "MADtensor" for configuration "Release"
+set_property(TARGET MADtensor APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(MADtensor PROPERTIES
+  IMPORTED_LOCATION_RELEASE "/root/repo/_opt_build/src/madness/tensor/libMADtensor.so"
+  IMPORTED_SONAME_RELEASE "libMADtensor.so"
+  )
+
+# Import target "MADlinalg" for configuration "Release"
+set_property(TARGET MADlinalg APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(MADlinalg PROPERTIES
+  IMPORTED_LOCATION_RELEASE "/root/repo/_opt_build/src/madness/tensor/libMADlinalg.so"
+  IMPORTED_SONAME_RELEASE "libMADlinalg.so"
+  )
+
+# Import target "MADmra" for configuration "Release"
+set_property(TARGET MADmra APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(MADmra PROPERTIES
+  IMPORTED_LOCATION_RELEASE "/root/repo/_opt_build/src/madness/mra/libMADmra.so"
+  IMPORTED_SONAME_RELEASE "libMADmra.so"
+  )
+
+# Import target "mraplot" for configuration "Release"
+set_property(TARGET mraplot APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(mraplot PROPERTIES
+  IMPORTED_LOCATION_RELEASE "/root/repo/_opt_build/src/madness/mra/mraplot"
+  )
+
+# Import target "madness" for configuration "Release"
+set_property(TARGET madness APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(madness PROPERTIES
+  IMPORTED_LOCATION_RELEASE "/root/repo/_opt_build/src/madness/libmadness.so"
+  IMPORTED_SONAME_RELEASE "libmadness.so"
+  )
+
+# Import target "MADchem" for configuration "Release"
+set_property(TARGET MADchem APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(MADchem PROPERTIES
+  IMPORTED_LOCATION_RELEASE "/root/repo/_opt_build/src/apps/chem/libMADchem.so"
+  IMPORTED_SONAME_RELEASE "libMADchem.so"
+  )
+
+# This file does not depend on other imported targets which have
+# been exported from the same project but in a separate export set.
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
+cmake_policy(POP)
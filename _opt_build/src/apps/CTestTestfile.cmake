@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/apps
+# Build directory: /root/repo/_opt_build/src/apps
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("chem")
+subdirs("tdse")
+subdirs("moldft")
@@ -0,0 +1,36 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/apps/chem/CC2.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/CC2.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/CC2.cc.o.d"
+  "/root/repo/src/apps/chem/CCOperators.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/CCOperators.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/CCOperators.cc.o.d"
+  "/root/repo/src/apps/chem/CISOperators.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/CISOperators.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/CISOperators.cc.o.d"
+  "/root/repo/src/apps/chem/SCF.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/SCF.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/SCF.cc.o.d"
+  "/root/repo/src/apps/chem/SCFOperators.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/SCFOperators.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/SCFOperators.cc.o.d"
+  "/root/repo/src/apps/chem/TDA.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/TDA.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/TDA.cc.o.d"
+  "/root/repo/src/apps/chem/TDA_XC.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/TDA_XC.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/TDA_XC.cc.o.d"
+  "/root/repo/src/apps/chem/atomutil.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/atomutil.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/atomutil.cc.o.d"
+  "/root/repo/src/apps/chem/corepotential.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/corepotential.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/corepotential.cc.o.d"
+  "/root/repo/src/apps/chem/correlationfactor.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/correlationfactor.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/correlationfactor.cc.o.d"
+  "/root/repo/src/apps/chem/distpm.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/distpm.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/distpm.cc.o.d"
+  "/root/repo/src/apps/chem/gth_pseudopotential.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/gth_pseudopotential.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/gth_pseudopotential.cc.o.d"
+  "/root/repo/src/apps/chem/lda.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/lda.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/lda.cc.o.d"
+  "/root/repo/src/apps/chem/molecularbasis.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/molecularbasis.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/molecularbasis.cc.o.d"
+  "/root/repo/src/apps/chem/molecule.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/molecule.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/molecule.cc.o.d"
+  "/root/repo/src/apps/chem/mp2.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/mp2.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/mp2.cc.o.d"
+  "/root/repo/src/apps/chem/nemo.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/nemo.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/nemo.cc.o.d"
+  "/root/repo/src/apps/chem/xcfunctional_ldaonly.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/xcfunctional_ldaonly.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/xcfunctional_ldaonly.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,43 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MADchem-obj.dir/CC2.cc.o"
+  "CMakeFiles/MADchem-obj.dir/CC2.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/CCOperators.cc.o"
+  "CMakeFiles/MADchem-obj.dir/CCOperators.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/CISOperators.cc.o"
+  "CMakeFiles/MADchem-obj.dir/CISOperators.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/SCF.cc.o"
+  "CMakeFiles/MADchem-obj.dir/SCF.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/SCFOperators.cc.o"
+  "CMakeFiles/MADchem-obj.dir/SCFOperators.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/TDA.cc.o"
+  "CMakeFiles/MADchem-obj.dir/TDA.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/TDA_XC.cc.o"
+  "CMakeFiles/MADchem-obj.dir/TDA_XC.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/atomutil.cc.o"
+  "CMakeFiles/MADchem-obj.dir/atomutil.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/corepotential.cc.o"
+  "CMakeFiles/MADchem-obj.dir/corepotential.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/correlationfactor.cc.o"
+  "CMakeFiles/MADchem-obj.dir/correlationfactor.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/distpm.cc.o"
+  "CMakeFiles/MADchem-obj.dir/distpm.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/gth_pseudopotential.cc.o"
+  "CMakeFiles/MADchem-obj.dir/gth_pseudopotential.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/lda.cc.o"
+  "CMakeFiles/MADchem-obj.dir/lda.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/molecularbasis.cc.o"
+  "CMakeFiles/MADchem-obj.dir/molecularbasis.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/molecule.cc.o"
+  "CMakeFiles/MADchem-obj.dir/molecule.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/mp2.cc.o"
+  "CMakeFiles/MADchem-obj.dir/mp2.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/nemo.cc.o"
+  "CMakeFiles/MADchem-obj.dir/nemo.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/xcfunctional_ldaonly.cc.o"
+  "CMakeFiles/MADchem-obj.dir/xcfunctional_ldaonly.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MADchem-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libMADchem.pdb"
+  "libMADchem.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MADchem.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_SCFOperators.dir/test_SCFOperators.cc.o"
+  "CMakeFiles/test_SCFOperators.dir/test_SCFOperators.cc.o.d"
+  "test_SCFOperators"
+  "test_SCFOperators.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_SCFOperators.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/apps/chem
+# Build directory: /root/repo/_opt_build/src/apps/chem
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(build_chem_unittests "/usr/bin/cmake" "--build" "/root/repo/_opt_build" "--target" "chem_unittests")
+set_tests_properties(build_chem_unittests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;8;add_test;/root/repo/src/apps/chem/CMakeLists.txt;46;add_unittests;/root/repo/src/apps/chem/CMakeLists.txt;0;")
+add_test(chem-test_SCFOperators "/root/repo/_opt_build/src/apps/chem/test_SCFOperators")
+set_tests_properties(chem-test_SCFOperators PROPERTIES  DEPENDS "build_chem_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/apps/chem/CMakeLists.txt;46;add_unittests;/root/repo/src/apps/chem/CMakeLists.txt;0;")
+add_test(chem-test_dft "/root/repo/_opt_build/src/apps/chem/test_dft")
+set_tests_properties(chem-test_dft PROPERTIES  DEPENDS "build_chem_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/apps/chem/CMakeLists.txt;46;add_unittests;/root/repo/src/apps/chem/CMakeLists.txt;0;")
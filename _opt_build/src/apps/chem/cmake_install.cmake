@@ -0,0 +1,101 @@
+# Install script for directory: /root/repo/src/apps/chem
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "chem" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMADchem.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMADchem.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMADchem.so"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_opt_build/src/apps/chem/libMADchem.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMADchem.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMADchem.so")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMADchem.so"
+         OLD_RPATH "/root/repo/_opt_build/src/madness/mra:/root/repo/_opt_build/src/madness/tensor:/root/repo/_opt_build/src/madness/misc:/root/repo/_opt_build/src/madness/world:/usr/lib/x86_64-linux-gnu/openmpi/lib:/root/repo/_opt_build/src/madness/external/tinyxml:/root/repo/_opt_build/src/madness/external/muParser:"
+         NEW_RPATH "")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMADchem.so")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "chem" OR NOT CMAKE_INSTALL_COMPONENT)
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "chem" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/chem" TYPE FILE FILES
+    "/root/repo/src/apps/chem/correlationfactor.cc"
+    "/root/repo/src/apps/chem/molecule.cc"
+    "/root/repo/src/apps/chem/molecularbasis.cc"
+    "/root/repo/src/apps/chem/corepotential.cc"
+    "/root/repo/src/apps/chem/atomutil.cc"
+    "/root/repo/src/apps/chem/lda.cc"
+    "/root/repo/src/apps/chem/distpm.cc"
+    "/root/repo/src/apps/chem/SCF.cc"
+    "/root/repo/src/apps/chem/gth_pseudopotential.cc"
+    "/root/repo/src/apps/chem/nemo.cc"
+    "/root/repo/src/apps/chem/mp2.cc"
+    "/root/repo/src/apps/chem/SCFOperators.cc"
+    "/root/repo/src/apps/chem/TDA.cc"
+    "/root/repo/src/apps/chem/TDA_XC.cc"
+    "/root/repo/src/apps/chem/CC2.cc"
+    "/root/repo/src/apps/chem/CCOperators.cc"
+    "/root/repo/src/apps/chem/CISOperators.cc"
+    "/root/repo/src/apps/chem/xcfunctional_ldaonly.cc"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "chem" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/share" TYPE FILE FILES
+    "/root/repo/src/apps/chem/sto-3g"
+    "/root/repo/src/apps/chem/sto-6g"
+    "/root/repo/src/apps/chem/6-31g"
+    "/root/repo/src/apps/chem/coredata/mcp"
+    "/root/repo/src/apps/chem/coredata/mcp2"
+    "/root/repo/src/apps/chem/coredata/mcp_guess"
+    )
+endif()
+
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mcpfit.dir/mcpfit.cc.o"
+  "CMakeFiles/mcpfit.dir/mcpfit.cc.o.d"
+  "mcpfit"
+  "mcpfit.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mcpfit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testperiodic_moldft.dir/testperiodic.cc.o"
+  "CMakeFiles/testperiodic_moldft.dir/testperiodic.cc.o.d"
+  "testperiodic_moldft"
+  "testperiodic_moldft.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testperiodic_moldft.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testpg.dir/testpg.cc.o"
+  "CMakeFiles/testpg.dir/testpg.cc.o.d"
+  "testpg"
+  "testpg.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testpg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tdse.dir/tdse.cc.o"
+  "CMakeFiles/tdse.dir/tdse.cc.o.d"
+  "tdse"
+  "tdse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tdse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
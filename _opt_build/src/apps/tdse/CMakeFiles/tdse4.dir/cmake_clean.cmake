@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tdse4.dir/tdse4.cc.o"
+  "CMakeFiles/tdse4.dir/tdse4.cc.o.d"
+  "tdse4"
+  "tdse4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tdse4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/csqrt.dir/csqrt.cc.o"
+  "CMakeFiles/csqrt.dir/csqrt.cc.o.d"
+  "csqrt"
+  "csqrt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/csqrt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
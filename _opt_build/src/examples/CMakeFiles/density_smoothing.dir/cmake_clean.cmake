@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/density_smoothing.dir/density_smoothing.cc.o"
+  "CMakeFiles/density_smoothing.dir/density_smoothing.cc.o.d"
+  "density_smoothing"
+  "density_smoothing.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/density_smoothing.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h2.dir/h2.cc.o"
+  "CMakeFiles/h2.dir/h2.cc.o.d"
+  "h2"
+  "h2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/h2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
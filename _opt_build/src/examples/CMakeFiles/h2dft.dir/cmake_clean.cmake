@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h2dft.dir/h2dft.cc.o"
+  "CMakeFiles/h2dft.dir/h2dft.cc.o.d"
+  "h2dft"
+  "h2dft.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/h2dft.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
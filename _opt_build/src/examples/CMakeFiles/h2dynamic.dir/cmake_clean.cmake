@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h2dynamic.dir/h2dynamic.cc.o"
+  "CMakeFiles/h2dynamic.dir/h2dynamic.cc.o.d"
+  "h2dynamic"
+  "h2dynamic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/h2dynamic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
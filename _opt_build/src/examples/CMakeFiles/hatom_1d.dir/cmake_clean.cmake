@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hatom_1d.dir/hatom_1d.cc.o"
+  "CMakeFiles/hatom_1d.dir/hatom_1d.cc.o.d"
+  "hatom_1d"
+  "hatom_1d.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hatom_1d.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
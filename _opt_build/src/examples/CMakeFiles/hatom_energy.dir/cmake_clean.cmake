@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hatom_energy.dir/hatom_energy.cc.o"
+  "CMakeFiles/hatom_energy.dir/hatom_energy.cc.o.d"
+  "hatom_energy"
+  "hatom_energy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hatom_energy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/he.dir/he.cc.o"
+  "CMakeFiles/he.dir/he.cc.o.d"
+  "he"
+  "he.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/he.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/heat2.dir/heat2.cc.o"
+  "CMakeFiles/heat2.dir/heat2.cc.o.d"
+  "heat2"
+  "heat2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/heat2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
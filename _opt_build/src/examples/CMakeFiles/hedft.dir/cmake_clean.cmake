@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hedft.dir/hedft.cc.o"
+  "CMakeFiles/hedft.dir/hedft.cc.o.d"
+  "hedft"
+  "hedft.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hedft.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hehf.dir/hehf.cc.o"
+  "CMakeFiles/hehf.dir/hehf.cc.o.d"
+  "hehf"
+  "hehf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hehf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
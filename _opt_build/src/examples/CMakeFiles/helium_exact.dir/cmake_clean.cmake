@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/helium_exact.dir/helium_exact.cc.o"
+  "CMakeFiles/helium_exact.dir/helium_exact.cc.o.d"
+  "helium_exact"
+  "helium_exact.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/helium_exact.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mp2.dir/mp2.cc.o"
+  "CMakeFiles/mp2.dir/mp2.cc.o.d"
+  "mp2"
+  "mp2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mp2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nemo.dir/nemo.cc.o"
+  "CMakeFiles/nemo.dir/nemo.cc.o.d"
+  "nemo"
+  "nemo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
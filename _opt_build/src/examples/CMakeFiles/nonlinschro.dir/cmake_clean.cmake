@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nonlinschro.dir/nonlinschro.cc.o"
+  "CMakeFiles/nonlinschro.dir/nonlinschro.cc.o.d"
+  "nonlinschro"
+  "nonlinschro.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nonlinschro.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pno.dir/pno.cc.o"
+  "CMakeFiles/pno.dir/pno.cc.o.d"
+  "pno"
+  "pno.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pno.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tdhf.dir/tdhf.cc.o"
+  "CMakeFiles/tdhf.dir/tdhf.cc.o.d"
+  "tdhf"
+  "tdhf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tdhf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
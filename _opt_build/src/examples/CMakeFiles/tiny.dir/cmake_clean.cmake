@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tiny.dir/tiny.cc.o"
+  "CMakeFiles/tiny.dir/tiny.cc.o.d"
+  "tiny"
+  "tiny.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tiny.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vnucso.dir/vnucso.cc.o"
+  "CMakeFiles/vnucso.dir/vnucso.cc.o.d"
+  "vnucso"
+  "vnucso.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vnucso.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
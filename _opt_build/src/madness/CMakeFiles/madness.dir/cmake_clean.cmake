@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libmadness.pdb"
+  "libmadness.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang ASM C CXX)
+  include(CMakeFiles/madness.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
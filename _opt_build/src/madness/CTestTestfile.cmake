@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/madness
+# Build directory: /root/repo/_opt_build/src/madness
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("external")
+subdirs("world")
+subdirs("misc")
+subdirs("tensor")
+subdirs("mra")
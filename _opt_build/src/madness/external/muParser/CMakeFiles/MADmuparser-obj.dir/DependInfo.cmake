@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/madness/external/muParser/muParser.cpp" "src/madness/external/muParser/CMakeFiles/MADmuparser-obj.dir/muParser.cpp.o" "gcc" "src/madness/external/muParser/CMakeFiles/MADmuparser-obj.dir/muParser.cpp.o.d"
+  "/root/repo/src/madness/external/muParser/muParserBase.cpp" "src/madness/external/muParser/CMakeFiles/MADmuparser-obj.dir/muParserBase.cpp.o" "gcc" "src/madness/external/muParser/CMakeFiles/MADmuparser-obj.dir/muParserBase.cpp.o.d"
+  "/root/repo/src/madness/external/muParser/muParserBytecode.cpp" "src/madness/external/muParser/CMakeFiles/MADmuparser-obj.dir/muParserBytecode.cpp.o" "gcc" "src/madness/external/muParser/CMakeFiles/MADmuparser-obj.dir/muParserBytecode.cpp.o.d"
+  "/root/repo/src/madness/external/muParser/muParserCallback.cpp" "src/madness/external/muParser/CMakeFiles/MADmuparser-obj.dir/muParserCallback.cpp.o" "gcc" "src/madness/external/muParser/CMakeFiles/MADmuparser-obj.dir/muParserCallback.cpp.o.d"
+  "/root/repo/src/madness/external/muParser/muParserError.cpp" "src/madness/external/muParser/CMakeFiles/MADmuparser-obj.dir/muParserError.cpp.o" "gcc" "src/madness/external/muParser/CMakeFiles/MADmuparser-obj.dir/muParserError.cpp.o.d"
+  "/root/repo/src/madness/external/muParser/muParserTokenReader.cpp" "src/madness/external/muParser/CMakeFiles/MADmuparser-obj.dir/muParserTokenReader.cpp.o" "gcc" "src/madness/external/muParser/CMakeFiles/MADmuparser-obj.dir/muParserTokenReader.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
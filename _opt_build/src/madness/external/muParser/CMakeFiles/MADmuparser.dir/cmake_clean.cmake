@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libMADmuparser.pdb"
+  "libMADmuparser.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MADmuparser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
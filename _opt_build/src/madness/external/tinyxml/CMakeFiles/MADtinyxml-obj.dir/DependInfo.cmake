@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/madness/external/tinyxml/tinystr.cc" "src/madness/external/tinyxml/CMakeFiles/MADtinyxml-obj.dir/tinystr.cc.o" "gcc" "src/madness/external/tinyxml/CMakeFiles/MADtinyxml-obj.dir/tinystr.cc.o.d"
+  "/root/repo/src/madness/external/tinyxml/tinyxml.cc" "src/madness/external/tinyxml/CMakeFiles/MADtinyxml-obj.dir/tinyxml.cc.o" "gcc" "src/madness/external/tinyxml/CMakeFiles/MADtinyxml-obj.dir/tinyxml.cc.o.d"
+  "/root/repo/src/madness/external/tinyxml/tinyxmlerror.cc" "src/madness/external/tinyxml/CMakeFiles/MADtinyxml-obj.dir/tinyxmlerror.cc.o" "gcc" "src/madness/external/tinyxml/CMakeFiles/MADtinyxml-obj.dir/tinyxmlerror.cc.o.d"
+  "/root/repo/src/madness/external/tinyxml/tinyxmlparser.cc" "src/madness/external/tinyxml/CMakeFiles/MADtinyxml-obj.dir/tinyxmlparser.cc.o" "gcc" "src/madness/external/tinyxml/CMakeFiles/MADtinyxml-obj.dir/tinyxmlparser.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
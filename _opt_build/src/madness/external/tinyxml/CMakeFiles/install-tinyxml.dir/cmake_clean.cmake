@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/install-tinyxml"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/install-tinyxml.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
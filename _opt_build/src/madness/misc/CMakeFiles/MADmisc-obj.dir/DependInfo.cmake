@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/madness/misc/cfft.cc" "src/madness/misc/CMakeFiles/MADmisc-obj.dir/cfft.cc.o" "gcc" "src/madness/misc/CMakeFiles/MADmisc-obj.dir/cfft.cc.o.d"
+  "/root/repo/src/madness/misc/checksum_file.cc" "src/madness/misc/CMakeFiles/MADmisc-obj.dir/checksum_file.cc.o" "gcc" "src/madness/misc/CMakeFiles/MADmisc-obj.dir/checksum_file.cc.o.d"
+  "/root/repo/src/madness/misc/gprofexit.cc" "src/madness/misc/CMakeFiles/MADmisc-obj.dir/gprofexit.cc.o" "gcc" "src/madness/misc/CMakeFiles/MADmisc-obj.dir/gprofexit.cc.o.d"
+  "/root/repo/src/madness/misc/meminfo.cc" "src/madness/misc/CMakeFiles/MADmisc-obj.dir/meminfo.cc.o" "gcc" "src/madness/misc/CMakeFiles/MADmisc-obj.dir/meminfo.cc.o.d"
+  "/root/repo/src/madness/misc/position_stream.cc" "src/madness/misc/CMakeFiles/MADmisc-obj.dir/position_stream.cc.o" "gcc" "src/madness/misc/CMakeFiles/MADmisc-obj.dir/position_stream.cc.o.d"
+  "/root/repo/src/madness/misc/ran.cc" "src/madness/misc/CMakeFiles/MADmisc-obj.dir/ran.cc.o" "gcc" "src/madness/misc/CMakeFiles/MADmisc-obj.dir/ran.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libMADmisc.pdb"
+  "libMADmisc.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MADmisc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/interp3.dir/interp3.cc.o"
+  "CMakeFiles/interp3.dir/interp3.cc.o.d"
+  "interp3"
+  "interp3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/interp3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
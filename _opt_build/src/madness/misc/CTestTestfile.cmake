@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/madness/misc
+# Build directory: /root/repo/_opt_build/src/madness/misc
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(build_misc_unittests "/usr/bin/cmake" "--build" "/root/repo/_opt_build" "--target" "misc_unittests")
+set_tests_properties(build_misc_unittests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;8;add_test;/root/repo/src/madness/misc/CMakeLists.txt;15;add_unittests;/root/repo/src/madness/misc/CMakeLists.txt;0;")
+add_test(misc-interp3 "/root/repo/_opt_build/src/madness/misc/interp3")
+set_tests_properties(misc-interp3 PROPERTIES  DEPENDS "build_misc_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/misc/CMakeLists.txt;15;add_unittests;/root/repo/src/madness/misc/CMakeLists.txt;0;")
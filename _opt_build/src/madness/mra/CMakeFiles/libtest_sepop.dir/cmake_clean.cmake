@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libtest_sepop.dir/test_sepop.cc.o"
+  "CMakeFiles/libtest_sepop.dir/test_sepop.cc.o.d"
+  "liblibtest_sepop.pdb"
+  "liblibtest_sepop.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libtest_sepop.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mraplot.dir/mraplot.cc.o"
+  "CMakeFiles/mraplot.dir/mraplot.cc.o.d"
+  "mraplot"
+  "mraplot.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mraplot.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test6.dir/test6.cc.o"
+  "CMakeFiles/test6.dir/test6.cc.o.d"
+  "test6"
+  "test6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testdiff1D.dir/testdiff1D.cc.o"
+  "CMakeFiles/testdiff1D.dir/testdiff1D.cc.o.d"
+  "testdiff1D"
+  "testdiff1D.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testdiff1D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testdiff1Db.dir/testdiff1Db.cc.o"
+  "CMakeFiles/testdiff1Db.dir/testdiff1Db.cc.o.d"
+  "testdiff1Db"
+  "testdiff1Db.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testdiff1Db.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testdiff3D.dir/testdiff3D.cc.o"
+  "CMakeFiles/testdiff3D.dir/testdiff3D.cc.o.d"
+  "testdiff3D"
+  "testdiff3D.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testdiff3D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
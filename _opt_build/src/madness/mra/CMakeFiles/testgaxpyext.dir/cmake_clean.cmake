@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testgaxpyext.dir/testgaxpyext.cc.o"
+  "CMakeFiles/testgaxpyext.dir/testgaxpyext.cc.o.d"
+  "testgaxpyext"
+  "testgaxpyext.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testgaxpyext.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testinnerext.dir/testinnerext.cc.o"
+  "CMakeFiles/testinnerext.dir/testinnerext.cc.o.d"
+  "testinnerext"
+  "testinnerext.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testinnerext.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testpdiff.dir/testpdiff.cc.o"
+  "CMakeFiles/testpdiff.dir/testpdiff.cc.o.d"
+  "testpdiff"
+  "testpdiff.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testpdiff.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testper.dir/testper.cc.o"
+  "CMakeFiles/testper.dir/testper.cc.o.d"
+  "testper"
+  "testper.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testper.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
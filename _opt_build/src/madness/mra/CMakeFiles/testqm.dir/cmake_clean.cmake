@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testqm.dir/testqm.cc.o"
+  "CMakeFiles/testqm.dir/testqm.cc.o.d"
+  "testqm"
+  "testqm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testqm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testvmra.dir/testvmra.cc.o"
+  "CMakeFiles/testvmra.dir/testvmra.cc.o.d"
+  "testvmra"
+  "testvmra.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testvmra.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/madness/mra
+# Build directory: /root/repo/_opt_build/src/madness/mra
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(build_mra_unittests "/usr/bin/cmake" "--build" "/root/repo/_opt_build" "--target" "mra_unittests")
+set_tests_properties(build_mra_unittests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;8;add_test;/root/repo/src/madness/mra/CMakeLists.txt;41;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(mra-testbsh "/root/repo/_opt_build/src/madness/mra/testbsh")
+set_tests_properties(mra-testbsh PROPERTIES  DEPENDS "build_mra_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/mra/CMakeLists.txt;41;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(mra-testproj "/root/repo/_opt_build/src/madness/mra/testproj")
+set_tests_properties(mra-testproj PROPERTIES  DEPENDS "build_mra_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/mra/CMakeLists.txt;41;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(mra-testpdiff "/root/repo/_opt_build/src/madness/mra/testpdiff")
+set_tests_properties(mra-testpdiff PROPERTIES  DEPENDS "build_mra_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/mra/CMakeLists.txt;41;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(mra-testdiff1Db "/root/repo/_opt_build/src/madness/mra/testdiff1Db")
+set_tests_properties(mra-testdiff1Db PROPERTIES  DEPENDS "build_mra_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/mra/CMakeLists.txt;41;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(mra-testgconv "/root/repo/_opt_build/src/madness/mra/testgconv")
+set_tests_properties(mra-testgconv PROPERTIES  DEPENDS "build_mra_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/mra/CMakeLists.txt;41;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(mra-testopdir "/root/repo/_opt_build/src/madness/mra/testopdir")
+set_tests_properties(mra-testopdir PROPERTIES  DEPENDS "build_mra_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/mra/CMakeLists.txt;41;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(mra-testinnerext "/root/repo/_opt_build/src/madness/mra/testinnerext")
+set_tests_properties(mra-testinnerext PROPERTIES  DEPENDS "build_mra_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/mra/CMakeLists.txt;41;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(mra-testgaxpyext "/root/repo/_opt_build/src/madness/mra/testgaxpyext")
+set_tests_properties(mra-testgaxpyext PROPERTIES  DEPENDS "build_mra_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/mra/CMakeLists.txt;41;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(mra-testvmra "/root/repo/_opt_build/src/madness/mra/testvmra")
+set_tests_properties(mra-testvmra PROPERTIES  DEPENDS "build_mra_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/mra/CMakeLists.txt;41;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(build_mra_sepop_unittests "/usr/bin/cmake" "--build" "/root/repo/_opt_build" "--target" "mra_sepop_unittests")
+set_tests_properties(build_mra_sepop_unittests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;8;add_test;/root/repo/src/madness/mra/CMakeLists.txt;44;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(mra_sepop-testsuite "/root/repo/_opt_build/src/madness/mra/testsuite")
+set_tests_properties(mra_sepop-testsuite PROPERTIES  DEPENDS "build_mra_sepop_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/mra/CMakeLists.txt;44;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(mra_sepop-testper "/root/repo/_opt_build/src/madness/mra/testper")
+set_tests_properties(mra_sepop-testper PROPERTIES  DEPENDS "build_mra_sepop_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/mra/CMakeLists.txt;44;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libMADlinalg.pdb"
+  "libMADlinalg.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MADlinalg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,57 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  "ASM"
+  )
+# The set of files for implicit dependencies of each language:
+set(CMAKE_DEPENDS_CHECK_ASM
+  "/root/repo/src/madness/tensor/mtxmq_asm.S" "/root/repo/_opt_build/src/madness/tensor/CMakeFiles/MADtensor-obj.dir/mtxmq_asm.S.o"
+  )
+set(CMAKE_ASM_COMPILER_ID "GNU")
+
+# Preprocessor definitions for this target.
+set(CMAKE_TARGET_DEFINITIONS_ASM
+  "MPICH_SKIP_MPICXX=1"
+  "OMPI_SKIP_MPICXX=1"
+  "X86_64"
+  )
+
+# The include file search paths:
+set(CMAKE_ASM_TARGET_INCLUDE_PATH
+  "src/madness/tensor"
+  "/root/repo/src/madness/tensor"
+  "/root/repo/src"
+  "src"
+  "/usr/lib/x86_64-linux-gnu/openmpi/include"
+  "/usr/lib/x86_64-linux-gnu/openmpi/include/openmpi"
+  "src/madness/world"
+  "/root/repo/src/madness/world"
+  "src/madness/misc"
+  "/root/repo/src/madness/misc"
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/madness/tensor/basetensor.cc" "src/madness/tensor/CMakeFiles/MADtensor-obj.dir/basetensor.cc.o" "gcc" "src/madness/tensor/CMakeFiles/MADtensor-obj.dir/basetensor.cc.o.d"
+  "/root/repo/src/madness/tensor/mtxmq.cc" "src/madness/tensor/CMakeFiles/MADtensor-obj.dir/mtxmq.cc.o" "gcc" "src/madness/tensor/CMakeFiles/MADtensor-obj.dir/mtxmq.cc.o.d"
+  "/root/repo/src/madness/tensor/mtxmq_simd.cc" "src/madness/tensor/CMakeFiles/MADtensor-obj.dir/mtxmq_simd.cc.o" "gcc" "src/madness/tensor/CMakeFiles/MADtensor-obj.dir/mtxmq_simd.cc.o.d"
+  "/root/repo/src/madness/tensor/tensor.cc" "src/madness/tensor/CMakeFiles/MADtensor-obj.dir/tensor.cc.o" "gcc" "src/madness/tensor/CMakeFiles/MADtensor-obj.dir/tensor.cc.o.d"
+  "/root/repo/src/madness/tensor/tensoriter.cc" "src/madness/tensor/CMakeFiles/MADtensor-obj.dir/tensoriter.cc.o" "gcc" "src/madness/tensor/CMakeFiles/MADtensor-obj.dir/tensoriter.cc.o.d"
+  "/root/repo/src/madness/tensor/vmath.cc" "src/madness/tensor/CMakeFiles/MADtensor-obj.dir/vmath.cc.o" "gcc" "src/madness/tensor/CMakeFiles/MADtensor-obj.dir/vmath.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/src/madness/tensor/tensor_spec.h" "/root/repo/src/madness/tensor/tensoriter_spec.h"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
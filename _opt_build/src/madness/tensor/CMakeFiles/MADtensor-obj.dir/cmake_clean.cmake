@@ -0,0 +1,22 @@
+file(REMOVE_RECURSE
+  "/root/repo/src/madness/tensor/tensor_spec.h"
+  "/root/repo/src/madness/tensor/tensoriter_spec.h"
+  "CMakeFiles/MADtensor-obj.dir/basetensor.cc.o"
+  "CMakeFiles/MADtensor-obj.dir/basetensor.cc.o.d"
+  "CMakeFiles/MADtensor-obj.dir/mtxmq.cc.o"
+  "CMakeFiles/MADtensor-obj.dir/mtxmq.cc.o.d"
+  "CMakeFiles/MADtensor-obj.dir/mtxmq_asm.S.o"
+  "CMakeFiles/MADtensor-obj.dir/mtxmq_simd.cc.o"
+  "CMakeFiles/MADtensor-obj.dir/mtxmq_simd.cc.o.d"
+  "CMakeFiles/MADtensor-obj.dir/tensor.cc.o"
+  "CMakeFiles/MADtensor-obj.dir/tensor.cc.o.d"
+  "CMakeFiles/MADtensor-obj.dir/tensoriter.cc.o"
+  "CMakeFiles/MADtensor-obj.dir/tensoriter.cc.o.d"
+  "CMakeFiles/MADtensor-obj.dir/vmath.cc.o"
+  "CMakeFiles/MADtensor-obj.dir/vmath.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang ASM CXX)
+  include(CMakeFiles/MADtensor-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libMADtensor.pdb"
+  "libMADtensor.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang ASM CXX)
+  include(CMakeFiles/MADtensor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_mtxmq.dir/bench_mtxmq.cc.o"
+  "CMakeFiles/bench_mtxmq.dir/bench_mtxmq.cc.o.d"
+  "bench_mtxmq"
+  "bench_mtxmq.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_mtxmq.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/jimkernel.dir/jimkernel.cc.o"
+  "CMakeFiles/jimkernel.dir/jimkernel.cc.o.d"
+  "jimkernel"
+  "jimkernel.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/jimkernel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_Zmtxmq.dir/test_Zmtxmq.cc.o"
+  "CMakeFiles/test_Zmtxmq.dir/test_Zmtxmq.cc.o.d"
+  "test_Zmtxmq"
+  "test_Zmtxmq.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_Zmtxmq.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
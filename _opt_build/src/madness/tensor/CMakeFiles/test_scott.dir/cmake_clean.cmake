@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_scott.dir/test_scott.cc.o"
+  "CMakeFiles/test_scott.dir/test_scott.cc.o.d"
+  "test_scott"
+  "test_scott.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_scott.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testseprep.dir/testseprep.cc.o"
+  "CMakeFiles/testseprep.dir/testseprep.cc.o.d"
+  "testseprep"
+  "testseprep.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testseprep.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
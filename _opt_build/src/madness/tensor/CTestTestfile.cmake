@@ -0,0 +1,32 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/madness/tensor
+# Build directory: /root/repo/_opt_build/src/madness/tensor
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(build_tensor_unittests "/usr/bin/cmake" "--build" "/root/repo/_opt_build" "--target" "tensor_unittests")
+set_tests_properties(build_tensor_unittests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;8;add_test;/root/repo/src/madness/tensor/CMakeLists.txt;77;add_unittests;/root/repo/src/madness/tensor/CMakeLists.txt;0;")
+add_test(tensor-test_tensor "/root/repo/_opt_build/src/madness/tensor/test_tensor")
+set_tests_properties(tensor-test_tensor PROPERTIES  DEPENDS "build_tensor_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/tensor/CMakeLists.txt;77;add_unittests;/root/repo/src/madness/tensor/CMakeLists.txt;0;")
+add_test(tensor-oldtest "/root/repo/_opt_build/src/madness/tensor/oldtest")
+set_tests_properties(tensor-oldtest PROPERTIES  DEPENDS "build_tensor_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/tensor/CMakeLists.txt;77;add_unittests;/root/repo/src/madness/tensor/CMakeLists.txt;0;")
+add_test(tensor-test_scott "/root/repo/_opt_build/src/madness/tensor/test_scott")
+set_tests_properties(tensor-test_scott PROPERTIES  DEPENDS "build_tensor_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/tensor/CMakeLists.txt;77;add_unittests;/root/repo/src/madness/tensor/CMakeLists.txt;0;")
+add_test(tensor-test_mtxmq "/root/repo/_opt_build/src/madness/tensor/test_mtxmq")
+set_tests_properties(tensor-test_mtxmq PROPERTIES  DEPENDS "build_tensor_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/tensor/CMakeLists.txt;77;add_unittests;/root/repo/src/madness/tensor/CMakeLists.txt;0;")
+add_test(tensor-jimkernel "/root/repo/_opt_build/src/madness/tensor/jimkernel")
+set_tests_properties(tensor-jimkernel PROPERTIES  DEPENDS "build_tensor_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/tensor/CMakeLists.txt;77;add_unittests;/root/repo/src/madness/tensor/CMakeLists.txt;0;")
+add_test(tensor-test_distributed_matrix "/root/repo/_opt_build/src/madness/tensor/test_distributed_matrix")
+set_tests_properties(tensor-test_distributed_matrix PROPERTIES  DEPENDS "build_tensor_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/tensor/CMakeLists.txt;77;add_unittests;/root/repo/src/madness/tensor/CMakeLists.txt;0;")
+add_test(tensor-test_Zmtxmq "/root/repo/_opt_build/src/madness/tensor/test_Zmtxmq")
+set_tests_properties(tensor-test_Zmtxmq PROPERTIES  DEPENDS "build_tensor_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/tensor/CMakeLists.txt;77;add_unittests;/root/repo/src/madness/tensor/CMakeLists.txt;0;")
+add_test(tensor-test_systolic "/root/repo/_opt_build/src/madness/tensor/test_systolic")
+set_tests_properties(tensor-test_systolic PROPERTIES  DEPENDS "build_tensor_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/tensor/CMakeLists.txt;77;add_unittests;/root/repo/src/madness/tensor/CMakeLists.txt;0;")
+add_test(build_linalg_unittests "/usr/bin/cmake" "--build" "/root/repo/_opt_build" "--target" "linalg_unittests")
+set_tests_properties(build_linalg_unittests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;8;add_test;/root/repo/src/madness/tensor/CMakeLists.txt;78;add_unittests;/root/repo/src/madness/tensor/CMakeLists.txt;0;")
+add_test(linalg-test_linalg "/root/repo/_opt_build/src/madness/tensor/test_linalg")
+set_tests_properties(linalg-test_linalg PROPERTIES  DEPENDS "build_linalg_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/tensor/CMakeLists.txt;78;add_unittests;/root/repo/src/madness/tensor/CMakeLists.txt;0;")
+add_test(linalg-test_solvers "/root/repo/_opt_build/src/madness/tensor/test_solvers")
+set_tests_properties(linalg-test_solvers PROPERTIES  DEPENDS "build_linalg_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/tensor/CMakeLists.txt;78;add_unittests;/root/repo/src/madness/tensor/CMakeLists.txt;0;")
+add_test(linalg-testseprep "/root/repo/_opt_build/src/madness/tensor/testseprep")
+set_tests_properties(linalg-testseprep PROPERTIES  DEPENDS "build_linalg_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/tensor/CMakeLists.txt;78;add_unittests;/root/repo/src/madness/tensor/CMakeLists.txt;0;")
@@ -0,0 +1,44 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/madness/world/lookup3.c" "src/madness/world/CMakeFiles/MADworld-obj.dir/lookup3.c.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/lookup3.c.o.d"
+  "/root/repo/src/madness/world/archive_type_names.cc" "src/madness/world/CMakeFiles/MADworld-obj.dir/archive_type_names.cc.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/archive_type_names.cc.o.d"
+  "/root/repo/src/madness/world/binary_fstream_archive.cc" "src/madness/world/CMakeFiles/MADworld-obj.dir/binary_fstream_archive.cc.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/binary_fstream_archive.cc.o.d"
+  "/root/repo/src/madness/world/debug.cc" "src/madness/world/CMakeFiles/MADworld-obj.dir/debug.cc.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/debug.cc.o.d"
+  "/root/repo/src/madness/world/deferred_cleanup.cc" "src/madness/world/CMakeFiles/MADworld-obj.dir/deferred_cleanup.cc.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/deferred_cleanup.cc.o.d"
+  "/root/repo/src/madness/world/future.cc" "src/madness/world/CMakeFiles/MADworld-obj.dir/future.cc.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/future.cc.o.d"
+  "/root/repo/src/madness/world/group.cc" "src/madness/world/CMakeFiles/MADworld-obj.dir/group.cc.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/group.cc.o.d"
+  "/root/repo/src/madness/world/info.cc" "src/madness/world/CMakeFiles/MADworld-obj.dir/info.cc.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/info.cc.o.d"
+  "/root/repo/src/madness/world/madness_exception.cc" "src/madness/world/CMakeFiles/MADworld-obj.dir/madness_exception.cc.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/madness_exception.cc.o.d"
+  "/root/repo/src/madness/world/print.cc" "src/madness/world/CMakeFiles/MADworld-obj.dir/print.cc.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/print.cc.o.d"
+  "/root/repo/src/madness/world/redirectio.cc" "src/madness/world/CMakeFiles/MADworld-obj.dir/redirectio.cc.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/redirectio.cc.o.d"
+  "/root/repo/src/madness/world/safempi.cc" "src/madness/world/CMakeFiles/MADworld-obj.dir/safempi.cc.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/safempi.cc.o.d"
+  "/root/repo/src/madness/world/text_fstream_archive.cc" "src/madness/world/CMakeFiles/MADworld-obj.dir/text_fstream_archive.cc.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/text_fstream_archive.cc.o.d"
+  "/root/repo/src/madness/world/thread.cc" "src/madness/world/CMakeFiles/MADworld-obj.dir/thread.cc.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/thread.cc.o.d"
+  "/root/repo/src/madness/world/timers.cc" "src/madness/world/CMakeFiles/MADworld-obj.dir/timers.cc.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/timers.cc.o.d"
+  "/root/repo/src/madness/world/world.cc" "src/madness/world/CMakeFiles/MADworld-obj.dir/world.cc.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/world.cc.o.d"
+  "/root/repo/src/madness/world/world_task_queue.cc" "src/madness/world/CMakeFiles/MADworld-obj.dir/world_task_queue.cc.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/world_task_queue.cc.o.d"
+  "/root/repo/src/madness/world/worldam.cc" "src/madness/world/CMakeFiles/MADworld-obj.dir/worldam.cc.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/worldam.cc.o.d"
+  "/root/repo/src/madness/world/worldgop.cc" "src/madness/world/CMakeFiles/MADworld-obj.dir/worldgop.cc.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/worldgop.cc.o.d"
+  "/root/repo/src/madness/world/worldmem.cc" "src/madness/world/CMakeFiles/MADworld-obj.dir/worldmem.cc.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/worldmem.cc.o.d"
+  "/root/repo/src/madness/world/worldmpi.cc" "src/madness/world/CMakeFiles/MADworld-obj.dir/worldmpi.cc.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/worldmpi.cc.o.d"
+  "/root/repo/src/madness/world/worldmutex.cc" "src/madness/world/CMakeFiles/MADworld-obj.dir/worldmutex.cc.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/worldmutex.cc.o.d"
+  "/root/repo/src/madness/world/worldpapi.cc" "src/madness/world/CMakeFiles/MADworld-obj.dir/worldpapi.cc.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/worldpapi.cc.o.d"
+  "/root/repo/src/madness/world/worldprofile.cc" "src/madness/world/CMakeFiles/MADworld-obj.dir/worldprofile.cc.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/worldprofile.cc.o.d"
+  "/root/repo/src/madness/world/worldref.cc" "src/madness/world/CMakeFiles/MADworld-obj.dir/worldref.cc.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/worldref.cc.o.d"
+  "/root/repo/src/madness/world/worldrmi.cc" "src/madness/world/CMakeFiles/MADworld-obj.dir/worldrmi.cc.o" "gcc" "src/madness/world/CMakeFiles/MADworld-obj.dir/worldrmi.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libMADworld.pdb"
+  "libMADworld.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/MADworld.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_atomicint.dir/test_atomicint.cc.o"
+  "CMakeFiles/test_atomicint.dir/test_atomicint.cc.o.d"
+  "test_atomicint"
+  "test_atomicint.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_atomicint.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
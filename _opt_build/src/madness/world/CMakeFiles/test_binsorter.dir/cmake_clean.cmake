@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_binsorter.dir/test_binsorter.cc.o"
+  "CMakeFiles/test_binsorter.dir/test_binsorter.cc.o.d"
+  "test_binsorter"
+  "test_binsorter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_binsorter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_future3.dir/test_future3.cc.o"
+  "CMakeFiles/test_future3.dir/test_future3.cc.o.d"
+  "test_future3"
+  "test_future3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_future3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_googletest.dir/test_googletest.cc.o"
+  "CMakeFiles/test_googletest.dir/test_googletest.cc.o.d"
+  "test_googletest"
+  "test_googletest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_googletest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
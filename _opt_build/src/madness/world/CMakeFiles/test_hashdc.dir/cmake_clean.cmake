@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_hashdc.dir/test_hashdc.cc.o"
+  "CMakeFiles/test_hashdc.dir/test_hashdc.cc.o.d"
+  "test_hashdc"
+  "test_hashdc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_hashdc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_worldprofile.dir/test_worldprofile.cc.o"
+  "CMakeFiles/test_worldprofile.dir/test_worldprofile.cc.o.d"
+  "test_worldprofile"
+  "test_worldprofile.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_worldprofile.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,46 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/madness/world
+# Build directory: /root/repo/_opt_build/src/madness/world
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(build_world_unittests "/usr/bin/cmake" "--build" "/root/repo/_opt_build" "--target" "world_unittests")
+set_tests_properties(build_world_unittests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;8;add_test;/root/repo/src/madness/world/CMakeLists.txt;62;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(world-test_prof "/root/repo/_opt_build/src/madness/world/test_prof")
+set_tests_properties(world-test_prof PROPERTIES  DEPENDS "build_world_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/world/CMakeLists.txt;62;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(world-test_ar "/root/repo/_opt_build/src/madness/world/test_ar")
+set_tests_properties(world-test_ar PROPERTIES  DEPENDS "build_world_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/world/CMakeLists.txt;62;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(world-test_hashdc "/root/repo/_opt_build/src/madness/world/test_hashdc")
+set_tests_properties(world-test_hashdc PROPERTIES  DEPENDS "build_world_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/world/CMakeLists.txt;62;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(world-test_hello "/root/repo/_opt_build/src/madness/world/test_hello")
+set_tests_properties(world-test_hello PROPERTIES  DEPENDS "build_world_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/world/CMakeLists.txt;62;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(world-test_atomicint "/root/repo/_opt_build/src/madness/world/test_atomicint")
+set_tests_properties(world-test_atomicint PROPERTIES  DEPENDS "build_world_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/world/CMakeLists.txt;62;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(world-test_future "/root/repo/_opt_build/src/madness/world/test_future")
+set_tests_properties(world-test_future PROPERTIES  DEPENDS "build_world_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/world/CMakeLists.txt;62;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(world-test_future2 "/root/repo/_opt_build/src/madness/world/test_future2")
+set_tests_properties(world-test_future2 PROPERTIES  DEPENDS "build_world_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/world/CMakeLists.txt;62;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(world-test_future3 "/root/repo/_opt_build/src/madness/world/test_future3")
+set_tests_properties(world-test_future3 PROPERTIES  DEPENDS "build_world_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/world/CMakeLists.txt;62;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(world-test_dc "/root/repo/_opt_build/src/madness/world/test_dc")
+set_tests_properties(world-test_dc PROPERTIES  DEPENDS "build_world_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/world/CMakeLists.txt;62;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(world-test_hashthreaded "/root/repo/_opt_build/src/madness/world/test_hashthreaded")
+set_tests_properties(world-test_hashthreaded PROPERTIES  DEPENDS "build_world_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/world/CMakeLists.txt;62;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(world-test_queue "/root/repo/_opt_build/src/madness/world/test_queue")
+set_tests_properties(world-test_queue PROPERTIES  DEPENDS "build_world_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/world/CMakeLists.txt;62;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(world-test_world "/root/repo/_opt_build/src/madness/world/test_world")
+set_tests_properties(world-test_world PROPERTIES  DEPENDS "build_world_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/world/CMakeLists.txt;62;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(world-test_worldprofile "/root/repo/_opt_build/src/madness/world/test_worldprofile")
+set_tests_properties(world-test_worldprofile PROPERTIES  DEPENDS "build_world_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/world/CMakeLists.txt;62;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(world-test_binsorter "/root/repo/_opt_build/src/madness/world/test_binsorter")
+set_tests_properties(world-test_binsorter PROPERTIES  DEPENDS "build_world_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/world/CMakeLists.txt;62;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(world-test_vector "/root/repo/_opt_build/src/madness/world/test_vector")
+set_tests_properties(world-test_vector PROPERTIES  DEPENDS "build_world_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/world/CMakeLists.txt;62;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(world-test_worldptr "/root/repo/_opt_build/src/madness/world/test_worldptr")
+set_tests_properties(world-test_worldptr PROPERTIES  DEPENDS "build_world_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/world/CMakeLists.txt;62;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(world-test_worldref "/root/repo/_opt_build/src/madness/world/test_worldref")
+set_tests_properties(world-test_worldref PROPERTIES  DEPENDS "build_world_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/world/CMakeLists.txt;62;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(world-test_stack "/root/repo/_opt_build/src/madness/world/test_stack")
+set_tests_properties(world-test_stack PROPERTIES  DEPENDS "build_world_unittests" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/world/CMakeLists.txt;62;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(world-test_googletest "/root/repo/_opt_build/src/madness/world/test_googletest")
+set_tests_properties(world-test_googletest PROPERTIES  DEPENDS "build_world_unittests" WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;22;add_test;/root/repo/src/madness/world/CMakeLists.txt;62;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
@@ -0,0 +1,126 @@
+# Install script for directory: /root/repo/src/madness/world
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "world" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMADworld.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMADworld.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMADworld.so"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_opt_build/src/madness/world/libMADworld.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMADworld.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMADworld.so")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMADworld.so"
+         OLD_RPATH "/usr/lib/x86_64-linux-gnu/openmpi/lib:"
+         NEW_RPATH "")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libMADworld.so")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "world" OR NOT CMAKE_INSTALL_COMPONENT)
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "world" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/madness/world" TYPE FILE FILES
+    "/root/repo/src/madness/world/info.h"
+    "/root/repo/src/madness/world/archive.h"
+    "/root/repo/src/madness/world/print.h"
+    "/root/repo/src/madness/world/worldam.h"
+    "/root/repo/src/madness/world/future.h"
+    "/root/repo/src/madness/world/worldmpi.h"
+    "/root/repo/src/madness/world/world_task_queue.h"
+    "/root/repo/src/madness/world/array_addons.h"
+    "/root/repo/src/madness/world/stack.h"
+    "/root/repo/src/madness/world/vector.h"
+    "/root/repo/src/madness/world/worldgop.h"
+    "/root/repo/src/madness/world/world_object.h"
+    "/root/repo/src/madness/world/buffer_archive.h"
+    "/root/repo/src/madness/world/nodefaults.h"
+    "/root/repo/src/madness/world/dependency_interface.h"
+    "/root/repo/src/madness/world/worldhash.h"
+    "/root/repo/src/madness/world/worldref.h"
+    "/root/repo/src/madness/world/worldtypes.h"
+    "/root/repo/src/madness/world/dqueue.h"
+    "/root/repo/src/madness/world/parallel_archive.h"
+    "/root/repo/src/madness/world/vector_archive.h"
+    "/root/repo/src/madness/world/madness_exception.h"
+    "/root/repo/src/madness/world/worldmem.h"
+    "/root/repo/src/madness/world/thread.h"
+    "/root/repo/src/madness/world/worldrmi.h"
+    "/root/repo/src/madness/world/safempi.h"
+    "/root/repo/src/madness/world/worldpapi.h"
+    "/root/repo/src/madness/world/worldmutex.h"
+    "/root/repo/src/madness/world/print_seq.h"
+    "/root/repo/src/madness/world/worldhashmap.h"
+    "/root/repo/src/madness/world/range.h"
+    "/root/repo/src/madness/world/atomicint.h"
+    "/root/repo/src/madness/world/posixmem.h"
+    "/root/repo/src/madness/world/worldptr.h"
+    "/root/repo/src/madness/world/deferred_cleanup.h"
+    "/root/repo/src/madness/world/MADworld.h"
+    "/root/repo/src/madness/world/world.h"
+    "/root/repo/src/madness/world/uniqueid.h"
+    "/root/repo/src/madness/world/worldprofile.h"
+    "/root/repo/src/madness/world/timers.h"
+    "/root/repo/src/madness/world/binary_fstream_archive.h"
+    "/root/repo/src/madness/world/mpi_archive.h"
+    "/root/repo/src/madness/world/text_fstream_archive.h"
+    "/root/repo/src/madness/world/worlddc.h"
+    "/root/repo/src/madness/world/mem_func_wrapper.h"
+    "/root/repo/src/madness/world/taskfn.h"
+    "/root/repo/src/madness/world/group.h"
+    "/root/repo/src/madness/world/dist_cache.h"
+    "/root/repo/src/madness/world/distributed_id.h"
+    "/root/repo/src/madness/world/type_traits.h"
+    "/root/repo/src/madness/world/function_traits.h"
+    "/root/repo/src/madness/world/stubmpi.h"
+    "/root/repo/src/madness/world/bgq_atomics.h"
+    "/root/repo/src/madness/world/binsorter.h"
+    )
+endif()
+
@@ -33,13 +33,46 @@
 #ifndef MADNESS_MRA_DISPLACEMENTS_H__INCLUDED
 #define MADNESS_MRA_DISPLACEMENTS_H__INCLUDED
 
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
 namespace madness {
+    /// DisplacementNorms keeps the operator norms for all displacements of one level
+
+    /// The norms are stored in a flat array in the same (sorted) order as the
+    /// displacements returned by SeparatedConvolution::get_disp(n).  In addition
+    /// we keep for each position the largest norm of all displacements from there
+    /// to the end of the list, so that the tail of negligible displacements for a
+    /// given source box can be cut off with a single search.
+    struct DisplacementNorms {
+        std::vector<double> norm;       ///< operator norm of displacement i
+        std::vector<double> tailnorm;   ///< max norm of displacements i..end (non-increasing)
+
+        DisplacementNorms() {}
+        DisplacementNorms(std::size_t n) : norm(n,0.0), tailnorm(n,0.0) {}
+
+        /// number of leading displacements that may contribute
+
+        /// all displacements beyond the returned index have norm <= bound
+        /// @param[in]  bound   the screening threshold for the operator norm, i.e. tol/cnorm
+        std::size_t nsurvive(const double bound) const {
+            return std::partition_point(tailnorm.begin(), tailnorm.end(),
+                    [bound](const double tn) {return tn>bound;}) - tailnorm.begin();
+        }
+    };
+
     /// Holds displacements for applying operators to avoid replicating for all operators
     template <std::size_t NDIM>
     class Displacements {
 
         static std::vector< Key<NDIM> > disp;
         static std::vector< Key<NDIM> > disp_periodicsum[64];
+        static std::vector< Key<NDIM> > disp_lowlevel[4];   ///< disp restricted to the cell on levels with 2^n-1 < bmax
+        static std::vector<hashT> offset;                   ///< hash offsets of disp, cf Key::hash_offset()
+        static std::vector<hashT> offset_periodicsum[64];
+        static std::vector<hashT> offset_lowlevel[4];
+        static Level nlowlevel;                             ///< number of levels with restricted displacements
 
     public:
         static int bmax_default() {
@@ -131,6 +164,32 @@ namespace madness {
             std::sort(disp.begin(), disp.end(), cmp_keys);
         }
 
+        /// the displacements that can have a destination in the cell on the low levels
+
+        /// on level n no displacement by more than 2^n-1 boxes stays in the cell,
+        /// so they are removed from the list once instead of in each apply task
+        static void make_disp_lowlevel(int bmax) {
+            nlowlevel=0;
+            while ((Translation(1)<<nlowlevel)-1 < bmax) {
+                const Translation lmax=(Translation(1)<<nlowlevel)-1;
+                MADNESS_ASSERT(nlowlevel<4);
+                disp_lowlevel[nlowlevel].clear();
+                for (typename std::vector< Key<NDIM> >::const_iterator it=disp.begin(); it!=disp.end(); ++it) {
+                    bool inside=true;
+                    for (std::size_t d=0; d<NDIM; ++d) inside=inside and (std::abs(it->translation()[d])<=lmax);
+                    if (inside) disp_lowlevel[nlowlevel].push_back(*it);
+                }
+                ++nlowlevel;
+            }
+        }
+
+        /// the hash offsets of a list of displacements
+        static std::vector<hashT> make_offset(const std::vector< Key<NDIM> >& d) {
+            std::vector<hashT> result(d.size());
+            for (std::size_t i=0; i<d.size(); ++i) result[i]=Key<NDIM>::hash_offset(d[i].translation());
+            return result;
+        }
+
         static void make_disp_periodicsum(int bmax, Level n) {
             Translation twon = Translation(1)<<n;
 
@@ -158,21 +217,30 @@ namespace madness {
             }
 
             std::sort(disp_periodicsum[n].begin(), disp_periodicsum[n].end(), cmp_keys_periodicsum);
+            offset_periodicsum[n]=make_offset(disp_periodicsum[n]);
 //             print("KEYS AT LEVEL", n);
 //             print(disp_periodicsum[n]);
         }
 
+        /// make all displacement tables
+        static bool make_tables() {
+            make_disp(bmax_default());
+            make_disp_lowlevel(bmax_default());
+            offset=make_offset(disp);
+            for (Level n=0; n<nlowlevel; ++n) offset_lowlevel[n]=make_offset(disp_lowlevel[n]);
+
+            if (NDIM <= 3) {
+                Level nmax = 8*sizeof(Translation) - 2;
+                for (Level n=0; n<nmax; ++n) make_disp_periodicsum(bmax_default(), n);
+            }
+            return true;
+        }
 
     public:
         Displacements() {
-            if (disp.size() == 0) {
-                make_disp(bmax_default());
-
-                if (NDIM <= 3) {
-                    Level nmax = 8*sizeof(Translation) - 2;
-                    for (Level n=0; n<nmax; ++n) make_disp_periodicsum(bmax_default(), n);
-                }
-            }
+            // the tables are made only once; initialization of a local static is thread-safe
+            static const bool initialized=make_tables();
+            MADNESS_ASSERT(initialized);
         }
 
         const std::vector< Key<NDIM> >& get_disp(Level n, bool isperiodicsum) {
@@ -180,11 +248,28 @@ namespace madness {
                 MADNESS_ASSERT(NDIM <= 3);
                 return disp_periodicsum[n];
             }
+            else if (n<nlowlevel) {
+                return disp_lowlevel[n];
+            }
             else {
                 return disp;
             }
         }
 
+        /// the hash offsets of the displacements, in the order of get_disp(n)
+        const std::vector<hashT>& get_hash_offsets(Level n, bool isperiodicsum) {
+            if (isperiodicsum) {
+                MADNESS_ASSERT(NDIM <= 3);
+                return offset_periodicsum[n];
+            }
+            else if (n<nlowlevel) {
+                return offset_lowlevel[n];
+            }
+            else {
+                return offset;
+            }
+        }
+
     };
 }
 #endif // MADNESS_MRA_DISPLACEMENTS_H__INCLUDED
@@ -183,6 +183,9 @@ namespace madness {
         static bool debug;             ///< Controls output of debug info
         static bool truncate_on_project; ///< If true initial projection inserts at n-1 not n
         static bool apply_randomize;   ///< If true use randomization for load balancing in apply integral operator
+        static int apply_batch_size;   ///< If >0 apply integral operators to batches of this many source boxes per task
+        static long apply_buffer_size; ///< Max number of destination boxes per process whose apply results are summed locally
+        static int transform_batch_size; ///< If >0 compress, reconstruct and mul transform batches of this many boxes per task
         static bool project_randomize; ///< If true use randomization for load balancing in project/refine
         static BoundaryConditions<NDIM> bc; ///< Default boundary conditions
         static Tensor<double> cell ;   ///< cell[NDIM][2] Simulation cell, cell(0,0)=xlo, cell(0,1)=xhi, ...
@@ -331,6 +334,54 @@ namespace madness {
             apply_randomize=value;
         }
 
+        /// Gets the number of source boxes per task when applying integral operators
+        static int get_apply_batch_size() {
+            return apply_batch_size;
+        }
+
+        /// Sets the number of source boxes per task when applying integral operators
+
+        /// With a value >0 the source boxes on each level are grouped into batches and the
+        /// operator is applied displacement by displacement to all boxes of a batch
+        /// (see FunctionImpl::apply_batched); 0 selects one task per source box.
+        static void set_apply_batch_size(int value) {
+            apply_batch_size=value;
+            MADNESS_ASSERT(value>=0);
+        }
+
+        /// Gets the max number of locally accumulated destination boxes when applying integral operators
+        static long get_apply_buffer_size() {
+            return apply_buffer_size;
+        }
+
+        /// Sets the max number of locally accumulated destination boxes when applying integral operators
+
+        /// Results of the operator for the same destination box are summed in a
+        /// per-process buffer and sent to the owner once at the end of the apply.
+        /// Once the buffer holds this many boxes, results for new destinations are
+        /// sent immediately; 0 disables the buffer.
+        static void set_apply_buffer_size(long value) {
+            apply_buffer_size=value;
+            MADNESS_ASSERT(value>=0);
+        }
+
+        /// Gets the number of boxes per task in the two-scale transforms of compress, reconstruct and mul
+        static int get_transform_batch_size() {
+            return transform_batch_size;
+        }
+
+        /// Sets the number of boxes per task in the two-scale transforms of compress, reconstruct and mul
+
+        /// With a value >0 fenced compress() and reconstruct() of full-rank functions
+        /// proceed level by level, and the boxes of a level are filtered or unfiltered
+        /// in batches of this size by a single task with one workspace (see
+        /// FunctionImpl::compress_batched); mul() converts sibling leaves to values
+        /// together.  0 selects one task per box.
+        static void set_transform_batch_size(int value) {
+            transform_batch_size=value;
+            MADNESS_ASSERT(value>=0);
+        }
+
 
         /// Gets the random load balancing for projection flag
         static bool get_project_randomize() {
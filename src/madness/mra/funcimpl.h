@@ -47,6 +47,7 @@
 #include <madness/mra/indexit.h>
 #include <madness/mra/key.h>
 #include <madness/mra/funcdefaults.h>
+#include <madness/mra/displacements.h>
 #include <madness/mra/function_factory.h>
 
 namespace madness {
@@ -927,6 +928,12 @@ namespace madness {
 
         dcT coeffs; ///< The coefficients
 
+        typedef ConcurrentHashMap<keyT,tensorT> applybufferT; ///< Type of the local buffer for operator results
+        applybufferT apply_buffer; ///< Operator results summed locally by destination box, see send_apply_result
+        AtomicInt apply_buffer_count; ///< Number of boxes in apply_buffer
+        long apply_buffer_max; ///< Max number of boxes in apply_buffer; 0 if not buffering
+        applybufferT twoscale_buffer; ///< Sum coefficients passed between the levels in compress_batched and reconstruct_batched
+
         // Disable the default copy constructor
         FunctionImpl(const FunctionImpl<T,NDIM>& p);
 
@@ -959,8 +966,10 @@ namespace madness {
             , compressed(factory._compressed)
             , redundant(false)
             , coeffs(world,factory._pmap,false)
+            , apply_buffer_max(0)
             //, bc(factory._bc)
         {
+            apply_buffer_count=0;
             // PROFILE_MEMBER_FUNC(FunctionImpl); // No need to profile this
             // !!! Ensure that all local state is correctly formed
             // before invoking process_pending for the coeffs and
@@ -1022,8 +1031,10 @@ namespace madness {
                          , compressed(other.compressed)
                          , redundant(other.redundant)
                          , coeffs(world, pmap ? pmap : other.coeffs.get_pmap())
+                         , apply_buffer_max(0)
                          //, bc(other.bc)
         {
+            apply_buffer_count=0;
             if (dozero) {
                 initial_level = 1;
                 insert_zero_down_to_initial_level(cdata.key0);
@@ -1843,6 +1854,44 @@ namespace madness {
         }
 
 
+        /// Multiplies the leaf coefficients of a batch of boxes, cf do_mul
+
+        /// the transforms to and from the values of all boxes share one workspace
+        /// @param[in] keys     the boxes, all local
+        /// @param[in] left     the scaling function coefficients of the left function in each box
+        /// @param[in] right    the scaling function coefficients of the right function in each box
+        template <typename L, typename R>
+        void do_mul_batch(const std::vector<keyT>& keys, const std::vector< Tensor<L> >& left,
+                          const std::vector< Tensor<R> >& right) {
+            const long n=keys.size();
+            if (cdata.npt != cdata.k) {
+                for (long i=0; i<n; ++i) do_mul<L,R>(keys[i], left[i], std::make_pair(keys[i],right[i]));
+                return;
+            }
+
+            std::vector< Tensor<L> > lcube(n);
+            std::vector< Tensor<R> > rcube(n);
+            std::vector<tensorT> tcube(n), result(n);
+            Tensor<L> lwork;
+            Tensor<R> rwork;
+            tensorT work;
+            fast_transform_batch(n, &left[0], cdata.quad_phit, &lcube[0], lwork);
+            fast_transform_batch(n, &right[0], cdata.quad_phit, &rcube[0], rwork);
+            for (long i=0; i<n; ++i) {
+                const double scale = pow(2.0,0.5*NDIM*keys[i].level())/sqrt(FunctionDefaults<NDIM>::get_cell_volume());
+                lcube[i].scale(scale);
+                rcube[i].scale(scale);
+                tcube[i] = tensorT(cdata.vk,false);
+                TERNARY_OPTIMIZED_ITERATOR(T, tcube[i], L, lcube[i], R, rcube[i], *_p0 = *_p1 * *_p2;);
+            }
+            fast_transform_batch(n, &tcube[0], cdata.quad_phiw, &result[0], work);
+            for (long i=0; i<n; ++i) {
+                const double scale = pow(0.5,0.5*NDIM*keys[i].level())*sqrt(FunctionDefaults<NDIM>::get_cell_volume());
+                coeffs.replace(keys[i], nodeT(coeffT(result[i].scale(scale),targs),false));
+            }
+        }
+
+
         /// multiply the values of two coefficient tensors using a custom number of grid points
 
         /// note both coefficient tensors have to refer to the same key!
@@ -2696,6 +2745,12 @@ namespace madness {
                 rss = right->unfilter(rd);
             }
 
+            // local children that are leaves on both sides are multiplied here, in batches
+            const std::size_t batch_size=FunctionDefaults<NDIM>::get_transform_batch_size();
+            std::vector<keyT> leaves;
+            std::vector< Tensor<L> > lleaves;
+            std::vector< Tensor<R> > rleaves;
+
             for (KeyChildIterator<NDIM> kit(key); kit; ++kit) {
                 const keyT& child = kit.key();
                 Tensor<L> ll;
@@ -2705,8 +2760,34 @@ namespace madness {
                 if (rc.size())
                     rr = copy(rss(child_patch(child)));
 
+                if (batch_size>0 && coeffs.is_local(child)) {
+                    if (ll.size()==0 && left->coeffs.is_local(child)) {
+                        literT it = left->coeffs.find(child).get();
+                        if (it != left->coeffs.end() && it->second.has_coeff())
+                            ll = it->second.coeff().full_tensor_copy();
+                    }
+                    if (rr.size()==0 && right->coeffs.is_local(child)) {
+                        riterT it = right->coeffs.find(child).get();
+                        if (it != right->coeffs.end() && it->second.has_coeff())
+                            rr = it->second.coeff().full_tensor_copy();
+                    }
+                    if (ll.size() && rr.size()) {
+                        leaves.push_back(child);
+                        lleaves.push_back(ll);
+                        rleaves.push_back(rr);
+                        if (leaves.size()==batch_size) {
+                            do_mul_batch<L,R>(leaves, lleaves, rleaves);
+                            leaves.clear();
+                            lleaves.clear();
+                            rleaves.clear();
+                        }
+                        continue;
+                    }
+                }
+
                 woT::task(coeffs.owner(child), &implT:: template mulXXa<L,R>, child, left, ll, right, rr, tol);
             }
+            if (leaves.size()) do_mul_batch<L,R>(leaves, lleaves, rleaves);
         }
 
 
@@ -3501,6 +3582,32 @@ namespace madness {
         ///   * Zero BC - returns invalid() to indicate out of volume
         keyT neighbor(const keyT& key, const keyT& disp, const std::vector<bool>& is_periodic) const;
 
+        /// Returns key of the neighbor for an operator displacement enforcing zero BC
+
+        /// Same as neighbor(key,disp,is_periodic) without periodic dimensions, but no
+        /// key is hashed anew: the hash follows from the unmixed hash of key and the
+        /// precomputed hash offset of the displacement, and the bounds are checked by
+        /// bit operations.  This is the version for the inner loop of apply.
+        /// @param[in]  key     the source key
+        /// @param[in]  lhash   key.linear_hash()
+        /// @param[in]  disp    the displacement of an operator acting on particle 1 or 2 (or all dimensions)
+        /// @param[in]  offset  the hash offset of disp, as returned by get_disp_hash_offsets()
+        /// @param[in]  particle    the particle the operator acts on
+        /// @return     the neighbor, or invalid() if it is out of volume
+        template<std::size_t OPDIM>
+        static keyT neighbor(const keyT& key, const hashT lhash, const Key<OPDIM>& disp,
+                hashT offset, const int particle) {
+            const std::size_t first=(particle==2) ? NDIM-OPDIM : 0;
+            if (first>0) offset=keyT::hash_offset(disp.translation(),first);
+
+            // translations of the neighbor must be in [0,2^n), i.e. have no bits above n set
+            const Translation outside=~((Translation(1)<<key.level())-1);
+            Translation bits=0;
+            for (std::size_t i=0; i<OPDIM; ++i) bits |= key.translation()[first+i]+disp.translation()[i];
+            if (bits & outside) return keyT::invalid();
+            return key.neighbor(disp.translation(),first,lhash,offset);
+        }
+
         /// find_me. Called by diff_bdry to get coefficients of boundary function
         Future< std::pair<keyT,coeffT> > find_me(const keyT& key) const;
 
@@ -4053,6 +4160,38 @@ namespace madness {
         // Invoked on node where key is local
         Future<coeffT > compress_spawn(const keyT& key, bool nonstandard, bool keepleaves, bool redundant);
 
+        /// compress a full-rank function level by level, filtering the boxes of a level in batches
+
+        /// gives the same result as compress(nonstandard,keepleaves,false,true); the
+        /// boxes with children on each level are split into batches of
+        /// FunctionDefaults<NDIM>::get_transform_batch_size() and each batch is
+        /// filtered by a single task, see compress_batch_op.  Fences once per level.
+        void compress_batched(bool nonstandard, bool keepleaves);
+
+        /// add the sum coefficients of child to the twoscale_buffer block of its parent
+
+        /// invoked where parent is local
+        void add_child_sum(const keyT& parent, const keyT& child, const tensorT& s);
+
+        /// filter a batch of local boxes of one level, cf compress_op
+
+        /// the children's sum coefficients are taken from twoscale_buffer, and the
+        /// box's own sum coefficients are left there for the level above
+        void compress_batch_op(const std::vector<keyT>& keys, bool nonstandard);
+
+        /// reconstruct a full-rank function level by level, unfiltering the boxes of a level in batches
+
+        /// gives the same result as reconstruct(true), cf compress_batched
+        void reconstruct_batched();
+
+        /// store the sum coefficients passed down from the parent of key in twoscale_buffer
+
+        /// invoked where key is local
+        void set_parent_sum(const keyT& key, const tensorT& s);
+
+        /// unfilter a batch of local boxes of one level, cf reconstruct_op
+        void reconstruct_batch_op(const std::vector<keyT>& keys);
+
         /// convert this to redundant, i.e. have sum coefficients on all levels
         void make_redundant(const bool fence);
 
@@ -4244,6 +4383,60 @@ namespace madness {
 
         }
 
+        /// send the result of an operator application to the destination node
+
+        /// while a buffered apply is running (see begin_apply_buffer) the result is
+        /// summed into the local buffer, so that each destination box receives
+        /// only one message per process; otherwise, or if the buffer is full, the
+        /// result is sent immediately
+        /// @param[in] dest     the destination box
+        /// @param[in] result   the contribution to the NS coefficients of dest
+        void send_apply_result(const keyT& dest, const tensorT& result) {
+            if (apply_buffer_max>0) {
+                typename applybufferT::accessor acc;
+                if (apply_buffer.find(acc,dest)) {
+                    if (acc->second.conforms(result)) {
+                        acc->second += result;
+                        return;
+                    }
+                }
+                else if (apply_buffer_count < apply_buffer_max) {
+                    if (apply_buffer.insert(acc,dest)) {
+                        apply_buffer_count++;
+                        acc->second = copy(result);
+                        return;
+                    }
+                    else if (acc->second.conforms(result)) {
+                        acc->second += result;
+                        return;
+                    }
+                }
+            }
+            coeffs.task(dest, &nodeT::accumulate2, result, coeffs, dest, TaskAttributes::hipri());
+        }
+
+        /// start summing operator results locally, up to FunctionDefaults<NDIM>::get_apply_buffer_size() boxes
+        void begin_apply_buffer() {
+            MADNESS_ASSERT(apply_buffer.size()==0);
+            apply_buffer_count=0;
+            apply_buffer_max=FunctionDefaults<NDIM>::get_apply_buffer_size();
+        }
+
+        /// send the locally summed operator results to their owners and stop buffering
+
+        /// must be called after a fence that guarantees that no more results are
+        /// added to the buffer; fences again if fence is true
+        void end_apply_buffer(bool fence) {
+            apply_buffer_max=0;
+            typename applybufferT::iterator end=apply_buffer.end();
+            for (typename applybufferT::iterator it=apply_buffer.begin(); it!=end; ++it) {
+                coeffs.task(it->first, &nodeT::accumulate2, it->second, coeffs, it->first, TaskAttributes::hipri());
+            }
+            apply_buffer.clear();
+            apply_buffer_count=0;
+            if (fence) world.gop.fence();
+        }
+
         /// apply an operator on the coeffs c (at node key)
 
         /// the result is accumulated inplace to this's tree at various FunctionNodes
@@ -4265,25 +4458,25 @@ namespace madness {
             //const long lmax = 1L << (key.level()-1);
 
             const std::vector<opkeyT>& disp = op->get_disp(key.level());
+            const std::vector<hashT>& disp_hash = op->get_disp_hash_offsets(key.level());
+            const double tol = truncate_tol(thresh, key);
 
-            // use to have static in front, but this is not thread-safe
-            const std::vector<bool> is_periodic(NDIM,false); // Periodic sum is already done when making rnlp
-
-            for (typename std::vector<opkeyT>::const_iterator it=disp.begin(); it != disp.end(); ++it) {
-                //                const opkeyT& d = *it;
+            // precomputed operator norms for all displacements on this level; all
+            // displacements beyond nsurvive are rigorously negligible for this box
+            const DisplacementNorms& opnorms = op->get_disp_norms(key.level());
+            const std::size_t nsurvive = opnorms.nsurvive(tol/fac/cnorm);
 
-                keyT d;
-                Key<NDIM-opdim> nullkey(key.level());
-                if (op->particle()==1) d=it->merge_with(nullkey);
-                if (op->particle()==2) d=nullkey.merge_with(*it);
+            // Periodic sum is already done when making rnlp, so zero BC for the destination
+            const hashT lhash = key.linear_hash();
 
-                keyT dest = neighbor(key, d, is_periodic);
+            for (std::size_t i=0; i<nsurvive; ++i) {
+                const opkeyT* it = &disp[i];
+                const keyT dest = neighbor(key, lhash, *it, disp_hash[i], op->particle());
 
                 if (dest.is_valid()) {
-                    double opnorm = op->norm(key.level(), *it, source);
+                    const double opnorm = opnorms.norm[i];
                     // working assumption here is that the operator is isotropic and
                     // montonically decreasing with distance
-                    double tol = truncate_tol(thresh, key);
 
                     //print("APP", key, dest, cnorm, opnorm, (cnorm*opnorm> tol/fac));
 
@@ -4298,10 +4491,10 @@ namespace madness {
                         // } else {
                             tensorT result = op->apply(source, *it, c, tol/fac/cnorm);
                             if (result.normf()> 0.3*tol/fac) {
-                                coeffs.task(dest, &nodeT::accumulate2, result, coeffs, dest, TaskAttributes::hipri());
+                                send_apply_result(dest, result);
                             }
                         // }
-                    } else if (d.distsq() >= 1)
+                    } else if (it->distsq() >= 1)
                         break; // Assumes monotonic decay beyond nearest neighbor
                 }
             }
@@ -4313,6 +4506,8 @@ namespace madness {
         void apply(opT& op, const FunctionImpl<R,NDIM>& f, bool fence) {
             PROFILE_MEMBER_FUNC(FunctionImpl);
             MADNESS_ASSERT(!op.modified());
+            // results can only be summed locally if we fence before the flush
+            if (fence) begin_apply_buffer();
             typename dcT::const_iterator end = f.coeffs.end();
             for (typename dcT::const_iterator it=f.coeffs.begin(); it!=end; ++it) {
                 // looping through all the coefficients in the source
@@ -4326,8 +4521,10 @@ namespace madness {
                     }
                 }
             }
-            if (fence)
+            if (fence) {
                 world.gop.fence();
+                end_apply_buffer(true);
+            }
 
             this->compressed=true;
             this->nonstandard=true;
@@ -4336,6 +4533,152 @@ namespace madness {
         }
 
 
+        /// apply an operator on the coeffs of a batch of source boxes on the same level
+
+        /// same result as calling do_apply for each box, but the loop over the
+        /// displacements is the outer loop, so that the operator block for one
+        /// displacement is applied to all boxes of the batch in one go.  Results
+        /// for the same destination box are summed locally and sent only once,
+        /// after all displacements have been processed.
+        /// @param[in] op	the operator to act on the source function
+        /// @param[in] key	keys of the source FunctionNodes of f, all on the same level
+        /// @param[in] c	coeffs of the source FunctionNodes
+        template <typename opT, typename R>
+        void do_apply_batch(const opT* op, const std::vector<keyT>& key, const std::vector< Tensor<R> >& c) {
+            PROFILE_MEMBER_FUNC(FunctionImpl);
+
+            typedef typename opT::keyT opkeyT;
+            MADNESS_ASSERT(key.size()==c.size());
+            if (key.size()==0) return;
+
+            const std::size_t nbatch=key.size();
+            const Level n=key[0].level();
+            const double fac = 10.0; // see do_apply
+            const double tol = truncate_tol(thresh, key[0]);
+
+            const std::vector<opkeyT>& disp = op->get_disp(n);
+            const std::vector<hashT>& disp_hash = op->get_disp_hash_offsets(n);
+            const DisplacementNorms& opnorms = op->get_disp_norms(n);
+
+            // per-box norms and screening limits; a box is done once it hits the
+            // assumed monotonic decay beyond the nearest neighbor
+            std::vector<opkeyT> source(nbatch);
+            std::vector<hashT> lhash(nbatch);
+            std::vector<double> cnorm(nbatch);
+            std::vector<std::size_t> nsurvive(nbatch);
+            std::vector<bool> done(nbatch,false);
+            std::size_t nmax=0;
+            for (std::size_t i=0; i<nbatch; ++i) {
+                MADNESS_ASSERT(key[i].level()==n);
+                source[i]=op->get_source_key(key[i]);
+                lhash[i]=key[i].linear_hash();
+                cnorm[i]=c[i].normf();
+                nsurvive[i]=opnorms.nsurvive(tol/fac/cnorm[i]);
+                nmax=std::max(nmax,nsurvive[i]);
+            }
+
+            // local accumulation of the results, keyed by the destination box
+            std::map<keyT,tensorT> accumulator;
+
+            std::vector<opkeyT> bsource;
+            std::vector<const Tensor<R>*> bcoeff;
+            std::vector<double> btol;
+            std::vector<keyT> bdest;
+
+            for (std::size_t idisp=0; idisp<nmax; ++idisp) {
+                const opkeyT& it = disp[idisp];
+                const double opnorm = opnorms.norm[idisp];
+
+                // collect all boxes of the batch that need this displacement
+                bsource.clear();
+                bcoeff.clear();
+                btol.clear();
+                bdest.clear();
+                bool alldone=true;
+                for (std::size_t i=0; i<nbatch; ++i) {
+                    if (done[i] or (idisp>=nsurvive[i])) continue;
+                    alldone=false;
+                    // Periodic sum is already done when making rnlp, so zero BC for the destination
+                    const keyT dest = neighbor(key[i], lhash[i], it, disp_hash[idisp], op->particle());
+                    if (not dest.is_valid()) continue;
+
+                    if (cnorm[i]*opnorm> tol/fac) {
+                        bsource.push_back(source[i]);
+                        bcoeff.push_back(&c[i]);
+                        btol.push_back(tol/fac/cnorm[i]);
+                        bdest.push_back(dest);
+                    } else if (it.distsq() >= 1) {
+                        done[i]=true; // Assumes monotonic decay beyond nearest neighbor
+                    }
+                }
+                if (alldone) break;
+
+                const std::vector<tensorT> result=op->apply_batch(bsource, it, bcoeff, btol);
+                for (std::size_t i=0; i<result.size(); ++i) {
+                    if (result[i].normf()> 0.3*tol/fac) {
+                        typename std::map<keyT,tensorT>::iterator acc=accumulator.find(bdest[i]);
+                        if (acc==accumulator.end()) accumulator.insert(std::make_pair(bdest[i],result[i]));
+                        else acc->second+=result[i];
+                    }
+                }
+            }
+
+            typename std::map<keyT,tensorT>::const_iterator end=accumulator.end();
+            for (typename std::map<keyT,tensorT>::const_iterator acc=accumulator.begin(); acc!=end; ++acc) {
+                send_apply_result(acc->first, acc->second);
+            }
+        }
+
+
+        /// apply an operator on f to return this, processing the source boxes in batches
+
+        /// alternative to apply(): the local source boxes are grouped by level into
+        /// batches of FunctionDefaults<NDIM>::get_apply_batch_size() boxes, and each
+        /// batch is processed by a single task with do_apply_batch
+        template <typename opT, typename R>
+        void apply_batched(opT& op, const FunctionImpl<R,NDIM>& f, bool fence) {
+            PROFILE_MEMBER_FUNC(FunctionImpl);
+            MADNESS_ASSERT(!op.modified());
+            const std::size_t batch_size=std::max(1,FunctionDefaults<NDIM>::get_apply_batch_size());
+            if (fence) begin_apply_buffer();
+
+            typedef std::pair< std::vector<keyT>, std::vector< Tensor<R> > > batchT;
+            std::map<Level,batchT> batches;
+
+            typename dcT::const_iterator end = f.coeffs.end();
+            for (typename dcT::const_iterator it=f.coeffs.begin(); it!=end; ++it) {
+                // looping through all the local coefficients in the source
+                const keyT& key = it->first;
+                const FunctionNode<R,NDIM>& node = it->second;
+                if (node.has_coeff()) {
+                    if (node.coeff().dim(0) != k || op.doleaves) {
+                        batchT& batch=batches[key.level()];
+                        batch.first.push_back(key);
+                        batch.second.push_back(node.coeff().reconstruct_tensor());
+                        if (batch.first.size()==batch_size) {
+                            ProcessID p = FunctionDefaults<NDIM>::get_apply_randomize() ? world.random_proc() : world.rank();
+                            woT::task(p, &implT:: template do_apply_batch<opT,R>, &op, batch.first, batch.second);
+                            batch=batchT();
+                        }
+                    }
+                }
+            }
+            for (typename std::map<Level,batchT>::const_iterator it=batches.begin(); it!=batches.end(); ++it) {
+                if (it->second.first.size()==0) continue;
+                ProcessID p = FunctionDefaults<NDIM>::get_apply_randomize() ? world.random_proc() : world.rank();
+                woT::task(p, &implT:: template do_apply_batch<opT,R>, &op, it->second.first, it->second.second);
+            }
+            if (fence) {
+                world.gop.fence();
+                end_apply_buffer(true);
+            }
+
+            this->compressed=true;
+            this->nonstandard=true;
+            this->redundant=false;
+        }
+
+
 
         /// apply an operator on the coeffs c (at node key)
 
@@ -4356,7 +4699,6 @@ namespace madness {
             std::list<opkeyT> blacklist;
 
             static const size_t opdim=opT::opdim;
-            Key<NDIM-opdim> nullkey(key.level());
 
             // source is that part of key that corresponds to those dimensions being processed
             const opkeyT source=op->get_source_key(key);
@@ -4376,23 +4718,21 @@ namespace madness {
             tensorT coeff_full;
 
             const std::vector<opkeyT>& disp = op->get_disp(key.level());
-            const std::vector<bool> is_periodic(NDIM,false); // Periodic sum is already done when making rnlp
+            const std::vector<hashT>& disp_hash = op->get_disp_hash_offsets(key.level());
+            const hashT lhash = key.linear_hash();
+            if ((op->particle()!=1) and (op->particle()!=2)) {
+                MADNESS_EXCEPTION("confused particle in operato??",1);
+            }
 
-            for (typename std::vector<opkeyT>::const_iterator it=disp.begin(); it != disp.end(); ++it) {
-                const opkeyT& d = *it;
+            for (std::size_t idisp=0; idisp<disp.size(); ++idisp) {
+                const opkeyT& d = disp[idisp];
 
                 const int shell=d.distsq();
                 if (do_kernel and (shell>0)) break;
                 if ((not do_kernel) and (shell==0)) continue;
 
-                keyT disp1;
-                if (op->particle()==1) disp1=it->merge_with(nullkey);
-                else if (op->particle()==2) disp1=nullkey.merge_with(*it);
-                else {
-                    MADNESS_EXCEPTION("confused particle in operato??",1);
-                }
-
-                keyT dest = neighbor(key, disp1, is_periodic);
+                // Periodic sum is already done when making rnlp, so zero BC for the destination
+                keyT dest = neighbor(key, lhash, d, disp_hash[idisp], op->particle());
 
                 if (not dest.is_valid()) continue;
 
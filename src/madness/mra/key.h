@@ -298,6 +298,22 @@ namespace madness {
             return Key(this->level(),l);
         }
 
+        /// given a displacement, generate a neighbor key without rehashing; ignore boundary conditions
+
+        /// @param[in]  disp    the translations of the displacement, possibly of lower dimension
+        /// @param[in]  first   the first dimension of this the displacement refers to
+        /// @param[in]  lhash   linear_hash() of this
+        /// @param[in]  offset  hash_offset(disp,first)
+        /// @return     a new key
+        template<std::size_t DDIM>
+        Key neighbor(const Vector<Translation,DDIM>& disp, const std::size_t first,
+                const hashT lhash, const hashT offset) const {
+            Key result(*this);
+            for (std::size_t i=0; i<DDIM; ++i) result.l[first+i]+=disp[i];
+            result.hashval=mix_hash(lhash+offset);
+            return result;
+        }
+
 
         /// check if this MultiIndex contains point x, disregarding these two dimensions
         bool thisKeyContains(const Vector<double,NDIM>& x, const unsigned int& dim0,
@@ -364,13 +380,56 @@ namespace madness {
         }
 
 
+        /// the unmixed hash of this key, cf. rehash()
+        hashT
+        linear_hash() const {
+            hashT h = hash_multiplier(0)*hashT(n);
+            for (std::size_t d = 0; d < NDIM; ++d)
+                h += hash_multiplier(d + 1)*hashT(l[d]);
+            return h;
+        }
+
+        /// the change of the unmixed hash of a key if it is displaced by d
+
+        /// @param[in]  d       the translations of the displacement
+        /// @param[in]  first   the first dimension of the key the displacement refers to
+        template<std::size_t DDIM>
+        static hashT
+        hash_offset(const Vector<Translation, DDIM>& d, const std::size_t first=0) {
+            hashT h = 0;
+            for (std::size_t i = 0; i < DDIM; ++i)
+                h += hash_multiplier(first + i + 1)*hashT(d[i]);
+            return h;
+        }
+
         /// Recomputes hashval ... presently only done when reading from external storage
+
+        /// The hash is a linear combination of level and translations, followed by a
+        /// mixing step.  Thus the hash of a neighbor is available from the unmixed hash
+        /// of the key and the hash offset of the displacement, cf. neighbor().
         void
         rehash() {
             //hashval = sdbm(sizeof(n)+sizeof(l), (unsigned char*)(&n));
-            // default hash is still best
-            hashval = hash_value(l);
-            hash_combine(hashval, n);
+            hashval = mix_hash(linear_hash());
+        }
+
+    private:
+        /// odd multipliers for the linear hash, index 0 is for the level
+        static hashT
+        hash_multiplier(const std::size_t i) {
+            return hashT(0x9e3779b97f4a7c15ull)*hashT(2*i + 1);
+        }
+
+        /// the finalizer of MurmurHash3, a bijection with good avalanche properties
+        static hashT
+        mix_hash(hashT h) {
+            uint64_t k = h;
+            k ^= k >> 33;
+            k *= 0xff51afd7ed558ccdull;
+            k ^= k >> 33;
+            k *= 0xc4ceb9fe1a85ec53ull;
+            k ^= k >> 33;
+            return hashT(k);
         }
     };
 
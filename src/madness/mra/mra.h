@@ -1921,7 +1921,11 @@ namespace madness {
         // specialized version for 3D
         if (NDIM <= 3) {
             result.set_impl(f, true);
-            result.get_impl()->apply(op, *f.get_impl(), fence);
+            if (FunctionDefaults<NDIM>::get_apply_batch_size()>0) {
+                result.get_impl()->apply_batched(op, *f.get_impl(), fence);
+            } else {
+                result.get_impl()->apply(op, *f.get_impl(), fence);
+            }
 
         } else {        // general version for higher dimension
             Function<TENSOR_RESULT_TYPE(typename opT::opT,R), NDIM> r1;
@@ -1447,6 +1447,10 @@ namespace madness {
         // Must set true here so that successive calls without fence do the right thing
         MADNESS_ASSERT(not is_redundant());
         nonstandard = compressed = redundant = false;
+        if (fence && targs.tt==TT_FULL && FunctionDefaults<NDIM>::get_transform_batch_size()>0) {
+            reconstruct_batched();
+            return;
+        }
         if (world.rank() == coeffs.owner(cdata.key0))
             woT::task(world.rank(), &implT::reconstruct_op, cdata.key0,coeffT());
         if (fence)
@@ -1473,6 +1477,11 @@ namespace madness {
         // otherwise we loose information
         if (redundant) {MADNESS_ASSERT(keepleaves);}
 
+        if (!redundant && fence && targs.tt==TT_FULL && FunctionDefaults<NDIM>::get_transform_batch_size()>0) {
+            compress_batched(nonstandard, keepleaves);
+            return;
+        }
+
         //            this->print_tree();
         if (world.rank() == coeffs.owner(cdata.key0)) {
 
@@ -1482,6 +1491,117 @@ namespace madness {
             world.gop.fence();
     }
 
+    template <typename T, std::size_t NDIM>
+    void FunctionImpl<T,NDIM>::compress_batched(bool nonstandard, bool keepleaves) {
+        const std::size_t batch_size=FunctionDefaults<NDIM>::get_transform_batch_size();
+
+        // the local boxes by level
+        std::vector< std::vector<keyT> > levels;
+        typename dcT::iterator end = coeffs.end();
+        for (typename dcT::iterator it=coeffs.begin(); it!=end; ++it) {
+            const Level n=it->first.level();
+            if (levels.size()<=n) levels.resize(n+1);
+            levels[n].push_back(it->first);
+        }
+        long nlevel=levels.size();
+        world.gop.max(nlevel);
+        levels.resize(nlevel);
+
+        // a single box has nothing to filter
+        if (nlevel<2) {
+            if (world.rank() == coeffs.owner(cdata.key0))
+                compress_spawn(cdata.key0, nonstandard, keepleaves, false);
+            world.gop.fence();
+            return;
+        }
+
+        MADNESS_ASSERT(twoscale_buffer.size()==0);
+        for (long n=nlevel-1; n>0; --n) {
+            // pass the sum coefficients of level n up to the parents: the
+            // coefficients of the leaves, or what the batches of the
+            // previous step left in the buffer
+            const std::vector<keyT>& keys=levels[n];
+            for (std::size_t i=0; i<keys.size(); ++i) {
+                nodeT& node = coeffs.find(keys[i]).get()->second;
+                tensorT s;
+                if (node.has_children()) {
+                    typename applybufferT::accessor acc;
+                    if (twoscale_buffer.find(acc,keys[i])) {
+                        s=acc->second;
+                        twoscale_buffer.erase(acc);
+                    }
+                }
+                else if (node.has_coeff()) {
+                    s=node.coeff().full_tensor_copy();
+                    if (!keepleaves) node.clear_coeff();
+                }
+                if (s.size()==0) continue;
+                const keyT parent=keys[i].parent();
+                if (coeffs.is_local(parent)) add_child_sum(parent, keys[i], s);
+                else woT::task(coeffs.owner(parent), &implT::add_child_sum, parent, keys[i], s);
+            }
+            world.gop.fence();
+
+            // filter the boxes of level n-1
+            std::vector<keyT> batch;
+            const std::vector<keyT>& parents=levels[n-1];
+            for (std::size_t i=0; i<parents.size(); ++i) {
+                if (!coeffs.find(parents[i]).get()->second.has_children()) continue;
+                batch.push_back(parents[i]);
+                if (batch.size()==batch_size) {
+                    woT::task(world.rank(), &implT::compress_batch_op, batch, nonstandard);
+                    batch.clear();
+                }
+            }
+            if (batch.size()) woT::task(world.rank(), &implT::compress_batch_op, batch, nonstandard);
+            world.gop.fence();
+        }
+        twoscale_buffer.clear();
+    }
+
+    template <typename T, std::size_t NDIM>
+    void FunctionImpl<T,NDIM>::add_child_sum(const keyT& parent, const keyT& child, const tensorT& s) {
+        typename applybufferT::accessor acc;
+        if (twoscale_buffer.insert(acc,parent)) acc->second=tensorT(cdata.v2k);
+        acc->second(child_patch(child)) += s;
+    }
+
+    template <typename T, std::size_t NDIM>
+    void FunctionImpl<T,NDIM>::compress_batch_op(const std::vector<keyT>& keys, bool nonstandard) {
+        const long n=keys.size();
+        std::vector<tensorT> s(n), d(n);
+        for (long i=0; i<n; ++i) {
+            typename applybufferT::accessor acc;
+            if (twoscale_buffer.find(acc,keys[i])) s[i]=acc->second;
+            else s[i]=tensorT(cdata.v2k);
+        }
+        tensorT work;
+        fast_transform_batch(n, &s[0], cdata.hgT, &d[0], work);
+
+        // tighter thresh for internal nodes
+        TensorArgs targs2=targs;
+        targs2.thresh*=0.1;
+
+        for (long i=0; i<n; ++i) {
+            typename dcT::accessor acc;
+            MADNESS_ASSERT(coeffs.find(acc, keys[i]));
+            if (acc->second.has_coeff()) {
+                const tensorT c = acc->second.coeff().full_tensor_copy();
+                if (c.dim(0) == k) d[i](cdata.s0) += c;
+                else d[i] += c;
+            }
+
+            // the sum coefficients replace the children's in the buffer
+            typename applybufferT::accessor bacc;
+            twoscale_buffer.insert(bacc,keys[i]);
+            bacc->second=copy(d[i](cdata.s0));
+            bacc.release();
+
+            if (keys[i].level()> 0 && !nonstandard) d[i](cdata.s0) = 0.0;
+            acc->second.set_coeff(coeffT(d[i],targs2));
+        }
+    }
+
     /// convert this to redundant, i.e. have sum coefficients on all levels
     template <typename T, std::size_t NDIM>
     void FunctionImpl<T,NDIM>::make_redundant(const bool fence) {
@@ -2028,6 +2148,99 @@ namespace madness {
         }
     }
 
+    template <typename T, std::size_t NDIM>
+    void FunctionImpl<T,NDIM>::reconstruct_batched() {
+        const std::size_t batch_size=FunctionDefaults<NDIM>::get_transform_batch_size();
+        MADNESS_ASSERT(twoscale_buffer.size()==0);
+        if (world.rank() == coeffs.owner(cdata.key0)) set_parent_sum(cdata.key0, tensorT());
+
+        // the buffer holds the boxes of one level, which put their children there
+        while (true) {
+            std::vector<keyT> keys;
+            typename applybufferT::iterator end = twoscale_buffer.end();
+            for (typename applybufferT::iterator it=twoscale_buffer.begin(); it!=end; ++it) {
+                keys.push_back(it->first);
+            }
+            long nkey=keys.size();
+            world.gop.sum(nkey);
+            if (nkey==0) break;
+
+            for (std::size_t i=0; i<keys.size(); i+=batch_size) {
+                std::vector<keyT> batch(keys.begin()+i, keys.begin()+std::min(keys.size(),i+batch_size));
+                woT::task(world.rank(), &implT::reconstruct_batch_op, batch);
+            }
+            world.gop.fence();
+        }
+    }
+
+    template <typename T, std::size_t NDIM>
+    void FunctionImpl<T,NDIM>::set_parent_sum(const keyT& key, const tensorT& s) {
+        typename applybufferT::accessor acc;
+        twoscale_buffer.insert(acc,key);
+        acc->second=s;
+    }
+
+    template <typename T, std::size_t NDIM>
+    void FunctionImpl<T,NDIM>::reconstruct_batch_op(const std::vector<keyT>& keys) {
+        // as in reconstruct_op, but the boxes with children are collected and unfiltered together
+        std::vector<keyT> parents;
+        std::vector<tensorT> d, r;
+        for (std::size_t i=0; i<keys.size(); ++i) {
+            const keyT& key=keys[i];
+            tensorT s;
+            {
+                typename applybufferT::accessor acc;
+                MADNESS_ASSERT(twoscale_buffer.find(acc,key));
+                s=acc->second;
+                twoscale_buffer.erase(acc);
+            }
+
+            typename dcT::iterator it = coeffs.find(key).get();
+            if (it == coeffs.end()) {
+                coeffs.replace(key,nodeT(coeffT(),false));
+                it = coeffs.find(key).get();
+            }
+            nodeT& node = it->second;
+            if (node.has_children() && !node.has_coeff()) {
+                node.set_coeff(coeffT(cdata.v2k,targs));
+            }
+
+            if (node.has_children() || node.has_coeff()) {
+                tensorT c = node.coeff().full_tensor();
+                if (c.size()==0) c = tensorT(cdata.v2k);
+                if (key.level() > 0) c(cdata.s0) += s;
+                if (c.dim(0)==2*get_k()) {
+                    parents.push_back(key);
+                    d.push_back(c);
+                }
+                else {
+                    MADNESS_ASSERT(node.is_leaf());
+                }
+            }
+            else {
+                if (s.size()==0) s=tensorT(cdata.vk);
+                node.set_coeff(coeffT(copy(s),targs));
+            }
+        }
+        if (parents.size()==0) return;
+
+        r.resize(parents.size());
+        tensorT work;
+        fast_transform_batch(parents.size(), &d[0], cdata.hg, &r[0], work);
+
+        for (std::size_t i=0; i<parents.size(); ++i) {
+            nodeT& node = coeffs.find(parents[i]).get()->second;
+            node.clear_coeff();
+            node.set_has_children(true);
+            for (KeyChildIterator<NDIM> kit(parents[i]); kit; ++kit) {
+                const keyT& child = kit.key();
+                const tensorT ss = copy(r[i](child_patch(child)));
+                if (coeffs.is_local(child)) set_parent_sum(child, ss);
+                else woT::task(coeffs.owner(child), &implT::set_parent_sum, child, ss);
+            }
+        }
+    }
+
     template <typename T, std::size_t NDIM>
     Tensor<T> fcube(const Key<NDIM>& key, T (*f)(const Vector<double,NDIM>&), const Tensor<double>& qx) {
         //      fcube(key,typename FunctionFactory<T,NDIM>::FunctorInterfaceWrapper(f) , qx, fval);
@@ -3003,32 +3216,19 @@ namespace madness {
     }
 
 
-    static inline bool enforce_bc(bool is_periodic, Level n, Translation& l) {
-        Translation two2n = 1ul << n;
-        if (l < 0) {
-            if (is_periodic)
-                l += two2n; // Periodic BC
-            else
-                return false; // Zero BC
-        }
-        else if (l >= two2n) {
-            if (is_periodic)
-                l -= two2n; // Periodic BC
-            else
-                return false; // Zero BC
-        }
-        return true;
-    }
-
     template <typename T, std::size_t NDIM>
     Key<NDIM> FunctionImpl<T,NDIM>::neighbor(const keyT& key, const Key<NDIM>& disp, const std::vector<bool>& is_periodic) const {
         Vector<Translation,NDIM> l = key.translation();
 
+        // translations in the volume are in [0,2^n), periodic ones are wrapped by masking
+        const Translation mask = (Translation(1)<<key.level()) - 1;
         for (std::size_t axis=0; axis<NDIM; ++axis) {
             l[axis] += disp.translation()[axis];
 
-            //if (!enforce_bc(bc(axis,0), bc(axis,1), key.level(), l[axis])) {
-            if (!enforce_bc(is_periodic[axis], key.level(), l[axis])) {
+            if (is_periodic[axis]) {
+                l[axis] &= mask;
+            }
+            else if (l[axis] & ~mask) {
                 return keyT::invalid();
             }
         }
@@ -3297,6 +3497,9 @@ namespace madness {
         debug = false;
         truncate_on_project = true;
         apply_randomize = false;
+        apply_batch_size = 0;
+        apply_buffer_size = 10000;
+        transform_batch_size = 0;
         project_randomize = false;
         bc = BoundaryConditions<NDIM>(BC_FREE);
         tt = TT_FULL;
@@ -3322,6 +3525,9 @@ namespace madness {
     		std::cout << "                           debug" <<  ": " << debug << std::endl;
     		std::cout << "             truncate_on_project" <<  ": " << truncate_on_project << std::endl;
     		std::cout << "                 apply_randomize" <<  ": " << apply_randomize << std::endl;
+    		std::cout << "                apply_batch_size" <<  ": " << apply_batch_size << std::endl;
+    		std::cout << "               apply_buffer_size" <<  ": " << apply_buffer_size << std::endl;
+    		std::cout << "            transform_batch_size" <<  ": " << transform_batch_size << std::endl;
     		std::cout << "               project_randomize" <<  ": " << project_randomize << std::endl;
     		std::cout << "                              bc" <<  ": " << bc << std::endl;
     		std::cout << "                              tt" <<  ": " << tt << std::endl;
@@ -3341,6 +3547,9 @@ namespace madness {
     template <std::size_t NDIM> bool FunctionDefaults<NDIM>::debug;
     template <std::size_t NDIM> bool FunctionDefaults<NDIM>::truncate_on_project;
     template <std::size_t NDIM> bool FunctionDefaults<NDIM>::apply_randomize;
+    template <std::size_t NDIM> int FunctionDefaults<NDIM>::apply_batch_size;
+    template <std::size_t NDIM> long FunctionDefaults<NDIM>::apply_buffer_size;
+    template <std::size_t NDIM> int FunctionDefaults<NDIM>::transform_batch_size;
     template <std::size_t NDIM> bool FunctionDefaults<NDIM>::project_randomize;
     template <std::size_t NDIM> BoundaryConditions<NDIM> FunctionDefaults<NDIM>::bc;
     template <std::size_t NDIM> TensorType FunctionDefaults<NDIM>::tt;
@@ -3353,6 +3562,11 @@ namespace madness {
 
     template <std::size_t NDIM> std::vector< Key<NDIM> > Displacements<NDIM>::disp;
     template <std::size_t NDIM> std::vector< Key<NDIM> > Displacements<NDIM>::disp_periodicsum[64];
+    template <std::size_t NDIM> std::vector< Key<NDIM> > Displacements<NDIM>::disp_lowlevel[4];
+    template <std::size_t NDIM> std::vector<hashT> Displacements<NDIM>::offset;
+    template <std::size_t NDIM> std::vector<hashT> Displacements<NDIM>::offset_periodicsum[64];
+    template <std::size_t NDIM> std::vector<hashT> Displacements<NDIM>::offset_lowlevel[4];
+    template <std::size_t NDIM> Level Displacements<NDIM>::nlowlevel=0;
 
 }
 
@@ -148,6 +148,7 @@ namespace madness {
         // SeparatedConvolutionData keeps data for all terms and all dimensions and 1 displacement
         mutable SimpleCache< SeparatedConvolutionData<Q,NDIM>, NDIM > data; ///< cache for all terms, dims and displacements
         mutable SimpleCache< SeparatedConvolutionData<Q,NDIM>, 2*NDIM > mod_data; ///< cache for all terms, dims and displacements
+        mutable SimpleCache< DisplacementNorms, 1 > disp_norms; ///< cache for the screening tables of all levels
 
     public:
 
@@ -1042,6 +1043,11 @@ namespace madness {
             return Displacements<NDIM>().get_disp(n, isperiodicsum);
         }
 
+        /// return the hash offsets of the displacements, in the order of get_disp(n)
+        const std::vector<hashT>& get_disp_hash_offsets(Level n) const {
+            return Displacements<NDIM>().get_hash_offsets(n, isperiodicsum);
+        }
+
         /// return the operator norm for all terms, all dimensions and 1 displacement
         double norm(Level n, const Key<NDIM>& d, const Key<NDIM>& source_key) const {
             // SeparatedConvolutionData keeps data for all terms and all dimensions and 1 displacement
@@ -1049,6 +1055,31 @@ namespace madness {
             return getop(n, d, source_key)->norm;
         }
 
+        /// return the operator norms of all displacements on level n (NS form only)
+
+        /// the table is built once per level and then reused for all source boxes,
+        /// so that screening in the apply loop needs no cache lookup per displacement
+        /// @param[in]  n   level (=scale)
+        /// @return     the norms in the order of get_disp(n)
+        const DisplacementNorms& get_disp_norms(Level n) const {
+            MADNESS_ASSERT(not modified());
+            const DisplacementNorms* p = disp_norms.getptr(n,Translation(0));
+            if (p) return *p;
+
+            const std::vector< Key<NDIM> >& disp = get_disp(n);
+            DisplacementNorms table(disp.size());
+            for (std::size_t i=0; i<disp.size(); ++i) table.norm[i] = getop_ns(n,disp[i])->norm;
+
+            double tail=0.0;
+            for (std::size_t i=disp.size(); i>0; --i) {
+                tail = std::max(tail,table.norm[i-1]);
+                table.tailnorm[i-1] = tail;
+            }
+
+            disp_norms.set(n, Translation(0), table);
+            return *disp_norms.getptr(n,Translation(0));
+        }
+
         /// return that part of a hi-dim key that serves as the base for displacements of this operator
 
         /// if the function and the operator have the same dimension return key
@@ -1183,6 +1214,83 @@ namespace madness {
         }
 
 
+        /// apply this operator for one displacement on a batch of coefficients in full rank
+
+        /// same as apply(), but for many source boxes on the same level (NS form only).
+        /// The operator data for the displacement is fetched once, and each separated
+        /// term is applied to all boxes of the batch before moving on to the next term,
+        /// so that its 1D matrices are streamed through the cache only once.
+        /// @param[in]  source  the source keys, all on the same level
+        /// @param[in]  shift   the displacement, where the source coeffs come from
+        /// @param[in]  coeff   source coeffs in full rank, one tensor per source key
+        /// @param[in]  tol     thresh/#neigh*cnorm for each source key
+        /// @return     tensors of full rank with the results op(coeff), one per source key
+        template <typename T>
+        std::vector< Tensor<TENSOR_RESULT_TYPE(T,Q)> > apply_batch(const std::vector< Key<NDIM> >& source,
+                                                                   const Key<NDIM>& shift,
+                                                                   const std::vector< const Tensor<T>* >& coeff,
+                                                                   const std::vector<double>& tol) const {
+            typedef TENSOR_RESULT_TYPE(T,Q) resultT;
+            MADNESS_ASSERT(not modified());
+            MADNESS_ASSERT(source.size()==coeff.size() and source.size()==tol.size());
+
+            const std::size_t nbatch=source.size();
+            std::vector< Tensor<resultT> > r(nbatch);
+            if (nbatch==0) return r;
+
+            double cpu0=cpu_time();
+
+            const Level n=source[0].level();
+            ApplyTerms at;
+            at.r_term=true;
+            at.t_term=(n>0);
+
+            /// SeparatedConvolutionData keeps data for all terms and all dimensions and 1 displacement
+            const SeparatedConvolutionData<Q,NDIM>* op = getop_ns(n, shift);
+
+            std::vector< Tensor<T> > input(nbatch), f0(nbatch);
+            std::vector< Tensor<resultT> > r0(nbatch);
+            for (std::size_t i=0; i<nbatch; ++i) {
+                MADNESS_ASSERT(source[i].level()==n);
+                const Tensor<T>& c=*coeff[i];
+                MADNESS_ASSERT(c.ndim()==NDIM);
+                if (c.dim(0) == k) {
+                    // leaf node with only scaling coefficients, cf. apply()
+                    input[i] = Tensor<T>(v2k);
+                    input[i](s0) = c;
+                }
+                else {
+                    MADNESS_ASSERT(c.dim(0)==2*k);
+                    input[i] = c;
+                }
+                f0[i] = copy(c(s0));
+                r[i] = Tensor<resultT>(v2k);
+                r0[i] = Tensor<resultT>(vk);
+            }
+
+            Tensor<resultT> work1(v2k,false), work2(v2k,false);
+            Tensor<Q> work5(2*k,2*k);
+
+            for (int mu=0; mu<rank; ++mu) {
+                const SeparatedConvolutionInternal<Q,NDIM>& muop =  op->muops[mu];
+                const Q fac = ops[mu].getfac();
+                for (std::size_t i=0; i<nbatch; ++i) {
+                    const double tolmu = tol[i]/rank; // Error is per separated term
+                    if (muop.norm > tolmu) {
+                        muopxv_fast(at, muop.ops, input[i], f0[i], r[i], r0[i], tolmu/std::abs(fac), fac,
+                                    work1, work2, work5);
+                    }
+                }
+            }
+
+            for (std::size_t i=0; i<nbatch; ++i) r[i](s0).gaxpy(1.0,r0[i],1.0);
+            double cpu1=cpu_time();
+            timer_full.accumulate(cpu1-cpu0);
+
+            return r;
+        }
+
+
         /// apply this operator on only 1 particle of the coefficients in low rank form
 
         /// note the unfortunate mess with NDIM: here NDIM is the operator dimension, and FDIM is the
@@ -1372,12 +1480,31 @@ namespace madness {
             }
 
             // finally accumulate all the resultant terms into one tensor
+
+            // reduce truncates every term separately, which has a large
+            // overhead for many terms of small rank; reduce_randomized samples
+            // the concatenated terms once, its cost grows with their total rank
+            // (all costs in units of the size of a vector)
             double cpu0=cpu_time();
 
-            result0=reduce(r0_list,tol2*rank);
-            if (r_list.size()>0) r_list.front()(s0)+=result0;
-            result=reduce(r_list,tol2*rank);
-            result.reduce_rank(tol2*rank);
+            long total_rank=0;
+            double cost_reduce=0.0;
+            const double overhead=1000.0;
+            for (typename std::list<GenTensor<T> >::const_iterator it=r_list.begin(); it!=r_list.end(); ++it) {
+                total_rank+=it->rank();
+                cost_reduce+=2.0*(overhead+it->rank()*(it->rank()+coeff.rank()));
+            }
+            const double cost_randomized=4.0*2.0*total_rank*(coeff.rank()+16);
+
+            if (cost_randomized<cost_reduce) {
+                r_list.splice(r_list.end(),r0_list);
+                result=reduce_randomized(r_list,tol2*rank);
+            } else {
+                result0=reduce(r0_list,tol2*rank);
+                if (r_list.size()>0) r_list.front()(s0)+=result0;
+                result=reduce(r_list,tol2*rank);
+                result.reduce_rank(tol2*rank);
+            }
 
             double cpu1=cpu_time();
             timer_low_accumulate.accumulate(cpu1-cpu0);
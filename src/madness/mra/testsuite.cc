@@ -741,7 +741,7 @@ int test_op(World& world) {
     coeffs(0L) = pow(exponents(0L)/PI, 0.5*NDIM);
     SeparatedConvolution<T,NDIM> op(world, coeffs, exponents);
     START_TIMER;
-    Function<T,NDIM> r = apply(op,f);
+    Function<T,NDIM> r = madness::apply(op,f);
     END_TIMER("apply");
     r.verify_tree();
     f.verify_tree();
@@ -872,12 +872,23 @@ int test_coulomb(World& world) {
     Function<double,3> r = apply_only(op,f) ;
     END_TIMER("apply");
 
+    // the batched apply must reproduce the result of the plain apply
+    FunctionDefaults<3>::set_apply_batch_size(32);
+    START_TIMER;
+    Function<double,3> rbatch = apply_only(op,f) ;
+    END_TIMER("apply batched");
+    FunctionDefaults<3>::set_apply_batch_size(0);
 
     START_TIMER;
     r.reconstruct();
     END_TIMER("reconstruct result");
     r.verify_tree();
 
+    rbatch.reconstruct();
+    double batcherr=(rbatch-r).norm2();
+    if (world.rank() == 0) print("  batched apply diff", batcherr);
+    CHECK(batcherr, thresh, "err in test_coulomb batched apply");
+
     functorT fexact(new GaussianPotential(origin, expnt, coeff));
 
     double numeric=r(origin);
@@ -1278,6 +1289,206 @@ int test_apply_push_1d(World& world) {
 }
 
 
+/// test the neighbor keys of the apply loop against the general neighbor, and time both
+template <typename T, std::size_t NDIM>
+int test_neighbor(World& world) {
+    typedef Key<NDIM> keyT;
+    bool ok=true;
+    if (world.rank() == 0) print("Test neighbor keys, ndim =",NDIM);
+
+    FunctionDefaults<NDIM>::set_cubic_cell(-10.0,10.0);
+    const Function<T,NDIM> f = FunctionFactory<T,NDIM>(world);
+    const FunctionImpl<T,NDIM>& impl=*f.get_impl();
+    const std::vector<bool> nonperiodic(NDIM,false), periodic(NDIM,true);
+
+    // source boxes at the corners, the faces and the center of the cell
+    std::vector<keyT> keys;
+    for (Level n=0; n<6; ++n) {
+        const Translation twon=Translation(1)<<n;
+        Vector<Translation,NDIM> l;
+        for (Translation c=0; c<3; ++c) {
+            for (std::size_t d=0; d<NDIM; ++d) l[d]=(c*(twon-1)+d)/2%twon;
+            keys.push_back(keyT(n,l));
+        }
+    }
+
+    long nwrong=0, nperiodic_wrong=0, ncount=0;
+    for (std::size_t i=0; i<keys.size(); ++i) {
+        const keyT& key=keys[i];
+        const Level n=key.level();
+        const std::vector<keyT>& disp=Displacements<NDIM>().get_disp(n,false);
+        const std::vector<hashT>& offset=Displacements<NDIM>().get_hash_offsets(n,false);
+        const hashT lhash=key.linear_hash();
+        for (std::size_t j=0; j<disp.size(); ++j) {
+            const keyT d=disp[j];
+            const keyT ref=impl.neighbor(key,d,nonperiodic);
+            const keyT fast=FunctionImpl<T,NDIM>::neighbor(key,lhash,d,offset[j],1);
+            if ((ref.is_valid()!=fast.is_valid()) or (ref.is_valid() and not (ref==fast and ref.hash()==keyT(n,ref.translation()).hash()))) nwrong++;
+
+            // periodic neighbors are wrapped into the cell
+            Vector<Translation,NDIM> l=key.translation()+d.translation();
+            const Translation twon=Translation(1)<<n;
+            for (std::size_t k=0; k<NDIM; ++k) l[k]=((l[k]%twon)+twon)%twon;
+            if (not (impl.neighbor(key,d,periodic)==keyT(n,l))) nperiodic_wrong++;
+            ncount++;
+        }
+    }
+    CHECK(double(nwrong), 0.5, "fast neighbor");
+    CHECK(double(nperiodic_wrong), 0.5, "periodic neighbor");
+
+    // microbenchmark: the displacement loop of apply for a box in the cell center
+    const Level n=5;
+    const Vector<Translation,NDIM> lcenter(Translation(1)<<(n-1));
+    const keyT center(n,lcenter);
+    const std::vector<keyT>& disp=Displacements<NDIM>().get_disp(n,false);
+    const std::vector<hashT>& offset=Displacements<NDIM>().get_hash_offsets(n,false);
+    const int nrep=std::max(1,int(1000000/disp.size()));
+    hashT sum=0;
+    double cpu0=cpu_time();
+    for (int rep=0; rep<nrep; ++rep) {
+        const std::vector<bool> is_periodic(NDIM,false);
+        for (std::size_t j=0; j<disp.size(); ++j) sum+=impl.neighbor(center,disp[j],is_periodic).hash();
+    }
+    double cpu1=cpu_time();
+    for (int rep=0; rep<nrep; ++rep) {
+        const hashT lhash=center.linear_hash();
+        for (std::size_t j=0; j<disp.size(); ++j) sum-=FunctionImpl<T,NDIM>::neighbor(center,lhash,disp[j],offset[j],1).hash();
+    }
+    double cpu2=cpu_time();
+    CHECK(double(sum!=0), 0.5, "same hashes in benchmark");
+    if (world.rank() == 0) {
+        const double nkeys=double(nrep)*disp.size();
+        print("neighbor keys per microsecond: general",nkeys/(cpu1-cpu0)*1.e-6,"apply loop",nkeys/(cpu2-cpu1)*1.e-6);
+    }
+
+    world.gop.fence();
+    if (world.rank() == 0) print("neighbor keys OK",ok,"\n\n");
+    if (not ok) return 1;
+    return 0;
+}
+
+
+/// time compress, reconstruct and apply with and without the mTxmq kernels for fixed sizes
+int test_fixed_kernels(World& world) {
+    typedef Vector<double,3> coordT;
+    typedef std::shared_ptr< FunctionFunctorInterface<double,3> > functorT;
+    bool ok=true;
+    if (world.rank() == 0) print("Test mTxmq kernels for fixed sizes, k = 8, ndim = 3");
+
+    const double thresh=1e-4;
+    FunctionDefaults<3>::set_k(8);
+    FunctionDefaults<3>::set_thresh(thresh);
+    FunctionDefaults<3>::set_refine(true);
+    FunctionDefaults<3>::set_initial_level(2);
+    FunctionDefaults<3>::set_truncate_mode(1);
+    FunctionDefaults<3>::set_cubic_cell(-10,10);
+
+    const double expnt=100.0;
+    functorT functor(new Gaussian<double,3>(coordT(0.5), expnt, pow(expnt/PI,1.5)));
+    const Function<double,3> f=FunctionFactory<double,3>(world).functor(functor);
+    SeparatedConvolution<double,3> op=CoulombOperator(world, 1e-3, thresh);
+
+    // the first application computes the blocks of the operator, so it is not timed
+    apply(op,f);
+
+    const int nrep=10;
+    Function<double,3> r[2];
+    for (int fixed=0; fixed<2; ++fixed) {
+        const bool previous=set_mTxmq_fixed(fixed);
+        Function<double,3> g=copy(f);
+        double time[3]={0.0,0.0,0.0};
+        for (int rep=0; rep<nrep; ++rep) {
+            double start=wall_time();
+            g.compress();
+            time[0]+=wall_time()-start;
+            start=wall_time();
+            g.reconstruct();
+            time[1]+=wall_time()-start;
+        }
+        double start=wall_time();
+        r[fixed]=apply(op,g);
+        time[2]=wall_time()-start;
+        set_mTxmq_fixed(previous);
+        if (world.rank() == 0) {
+            print(fixed ? "  fixed kernels:" : "general kernels:","compress",time[0]/nrep,
+                  "reconstruct",time[1]/nrep,"apply",time[2]);
+        }
+    }
+    const double err=(r[0]-r[1]).norm2()/r[0].norm2();
+    CHECK(err, 1e-12, "same result with fixed kernels");
+
+    world.gop.fence();
+    if (world.rank() == 0) print("fixed kernels OK",ok,"\n\n");
+    if (not ok) return 1;
+    return 0;
+}
+
+int test_transform_batch(World& world) {
+    typedef Vector<double,3> coordT;
+    typedef std::shared_ptr< FunctionFunctorInterface<double,3> > functorT;
+    bool ok=true;
+    if (world.rank() == 0) print("Test batched two-scale transforms, k = 8, ndim = 3");
+
+    FunctionDefaults<3>::set_k(8);
+    FunctionDefaults<3>::set_thresh(1e-6);
+    FunctionDefaults<3>::set_refine(true);
+    FunctionDefaults<3>::set_initial_level(2);
+    FunctionDefaults<3>::set_truncate_mode(1);
+    FunctionDefaults<3>::set_cubic_cell(-10,10);
+
+    const double expnt=100.0;
+    functorT ff(new Gaussian<double,3>(coordT(0.5), expnt, pow(expnt/PI,1.5)));
+    functorT gg(new Gaussian<double,3>(coordT(0.55), 2.0*expnt, 1.0));
+    const Function<double,3> f=FunctionFactory<double,3>(world).functor(ff);
+    const Function<double,3> g=FunctionFactory<double,3>(world).functor(gg);
+    const double nbox=f.tree_size();
+
+    const int nrep=5;
+    const int batch_size[2]={0,32};
+    Function<double,3> c[2], r[2], p[2];
+    for (int b=0; b<2; ++b) {
+        FunctionDefaults<3>::set_transform_batch_size(batch_size[b]);
+        double time[3]={0.0,0.0,0.0};
+        for (int rep=0; rep<nrep; ++rep) {
+            Function<double,3> h=copy(f);
+            double start=wall_time();
+            h.compress();
+            time[0]+=wall_time()-start;
+            c[b]=copy(h);
+            start=wall_time();
+            h.reconstruct();
+            time[1]+=wall_time()-start;
+            r[b]=h;
+            start=wall_time();
+            p[b]=f*g;
+            time[2]+=wall_time()-start;
+        }
+        if (world.rank() == 0) {
+            print("batch size",batch_size[b],"boxes/s: compress",nrep*nbox/time[0],
+                  "reconstruct",nrep*nbox/time[1],"mul",nrep*nbox/time[2]);
+        }
+
+        // the sum coefficients that nonstandard keeps must be those of the function
+        Function<double,3> ns=copy(f);
+        ns.nonstandard(true,true);
+        ns.standard();
+        ns.reconstruct();
+        CHECK((ns-f).norm2()/f.norm2(), 1e-14, "nonstandard and back");
+    }
+    FunctionDefaults<3>::set_transform_batch_size(0);
+
+    CHECK((c[0]-c[1]).norm2()/c[0].norm2(), 1e-14, "same compressed function");
+    CHECK((r[0]-f).norm2()/f.norm2(), 1e-14, "reconstruct");
+    CHECK((r[1]-f).norm2()/f.norm2(), 1e-14, "batched reconstruct");
+    CHECK((p[0]-p[1]).norm2()/p[0].norm2(), 1e-14, "same product");
+
+    world.gop.fence();
+    if (world.rank() == 0) print("batched transforms OK",ok,"\n\n");
+    if (not ok) return 1;
+    return 0;
+}
+
+
 #define TO_STRING(s) TO_STRING2(s)
 #define TO_STRING2(s) #s
 
@@ -1371,6 +1582,10 @@ int main(int argc, char**argv) {
         nfail+=test_coulomb(world);
         nfail+=test_plot<double,3>(world);
         nfail+=test_io<double,3>(world);
+        nfail+=test_neighbor<double,3>(world);
+        nfail+=test_neighbor<double,6>(world);
+        nfail+=test_fixed_kernels(world);
+        nfail+=test_transform_batch(world);
 
         test_plot<double,4>(world); // slow unless reduce npt in test_plot
 
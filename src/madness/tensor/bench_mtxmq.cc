@@ -0,0 +1,140 @@
+/*
+  This file is part of MADNESS.
+
+  Copyright (C) 2007,2010 Oak Ridge National Laboratory
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+
+  For more information please contact:
+
+  Robert J. Harrison
+  Oak Ridge National Laboratory
+  One Bethel Valley Road
+  P.O. Box 2008, MS-6367
+
+  email: harrisonrj@ornl.gov
+  tel:   865-241-3937
+  fax:   865-572-0680
+
+  $Id$
+*/
+
+/// \file bench_mtxmq.cc
+/// \brief Reports the speed of every mTxmq kernel the host supports
+
+/// The shapes are those of the transforms in MRA for wavelet order
+/// k=4..20: fast_transform of the scaling coefficients, (k^(d-1),k,k),
+/// and of the sum and difference coefficients in compress and
+/// reconstruct, ((2k)^(d-1),2k,2k).  Dimensions d=1..3 are timed by
+/// default; the optional argument raises the maximum.
+///
+///     bench_mtxmq [maxndim]
+
+#include <madness/madness_config.h>
+#include <madness/tensor/tensor.h>
+#include <madness/tensor/mtxmq.h>
+#include <madness/world/timers.h>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace madness;
+
+/// Largest matrix timed, in elements
+static const long maxsize = 1l<<22;
+
+/// Floating point operations per multiply-add for the given types
+template <typename aT, typename bT> double flops() {return 2.0;}
+template <> double flops<double_complex,double_complex>() {return 8.0;}
+template <> double flops<double_complex,double>() {return 4.0;}
+template <> double flops<double,double_complex>() {return 4.0;}
+
+/// Returns the fastest rate in GF/s of mTxmq for a given shape
+
+/// Each of several trials repeats the multiplication for at least 20ms.
+template <typename aT, typename bT, typename cT>
+double timer(long dimi, long dimj, long dimk, cT* c, const aT* a, const bT* b) {
+    const double nflop = flops<aT,bT>()*dimi*dimj*dimk;
+    long nloop = std::max(1l, long(2e6/nflop));
+    double fastest = 0.0;
+    for (int trial=0; trial<5; ++trial) {
+        double used;
+        while (true) {
+            used = wall_time();
+            for (long loop=0; loop<nloop; ++loop) mTxmq(dimi, dimj, dimk, c, a, b);
+            used = wall_time() - used;
+            if (used > 0.02) break;
+            nloop *= 2;
+        }
+        fastest = std::max(fastest, 1e-9*nflop*nloop/used);
+    }
+    return fastest;
+}
+
+/// Times all kernels for one shape and prints a line
+template <typename aT, typename bT, typename cT>
+void shape(const char* type, long dimi, long dimj, long dimk, const std::vector<mTxmqISA>& isas) {
+    Tensor<aT> a(dimk,dimi);
+    Tensor<bT> b(dimk,dimj);
+    Tensor<cT> c(dimi,dimj);
+    a.fillrandom();
+    b.fillrandom();
+
+    printf("%14s %7ld %4ld %4ld", type, dimi, dimj, dimk);
+    for (unsigned int i=0; i<isas.size(); ++i) {
+        set_mTxmq_isa(isas[i]);
+        printf(" %8.2f", timer(dimi, dimj, dimk, c.ptr(), a.ptr(), b.ptr()));
+    }
+    printf("\n");
+    fflush(stdout);
+}
+
+template <typename aT, typename bT, typename cT>
+void shapes(const char* type, int maxndim, const std::vector<mTxmqISA>& isas) {
+    for (long k=4; k<=20; ++k) {
+        for (int d=1; d<=maxndim; ++d) {
+            for (long n=k; n<=2*k; n+=k) {
+                long dimi = 1;
+                for (int i=1; i<d; ++i) dimi *= n;
+                if (dimi*n > maxsize) continue;
+                shape<aT,bT,cT>(type, dimi, n, n, isas);
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    const int maxndim = (argc > 1) ? atoi(argv[1]) : 3;
+
+    // The kernels the host supports, in order of preference
+    const mTxmqISA best = mTxmq_isa();
+    std::vector<mTxmqISA> isas;
+    for (int i=MTXMQ_GENERIC; i<=best; ++i) {
+        if (set_mTxmq_isa(mTxmqISA(i)) == i) isas.push_back(mTxmqISA(i));
+    }
+
+    printf("mTxmq kernels, selected at startup: %s\n\n", mTxmq_isa_name(best));
+    printf("%14s %7s %4s %4s", "type", "dimi", "dimj", "dimk");
+    for (unsigned int i=0; i<isas.size(); ++i) printf(" %8s", mTxmq_isa_name(isas[i]));
+    printf("   (GF/s)\n");
+
+    shapes<double,double,double>("double", maxndim, isas);
+    shapes<double_complex,double_complex,double_complex>("complex", maxndim, isas);
+    shapes<double_complex,double,double_complex>("complex*real", maxndim, isas);
+    shapes<float,float,float>("float", maxndim, isas);
+
+    set_mTxmq_isa(best);
+    return 0;
+}
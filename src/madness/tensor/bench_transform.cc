@@ -0,0 +1,133 @@
+/*
+  This file is part of MADNESS.
+
+  Copyright (C) 2007,2010 Oak Ridge National Laboratory
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+
+  For more information please contact:
+
+  Robert J. Harrison
+  Oak Ridge National Laboratory
+  One Bethel Valley Road
+  P.O. Box 2008, MS-6367
+
+  email: harrisonrj@ornl.gov
+  tel:   865-241-3937
+  fax:   865-572-0680
+
+  $Id$
+*/
+
+/// \file bench_transform.cc
+/// \brief Compares the ways of transforming all dimensions of a tensor
+
+/// For cubes of side k in 3D and 6D, reports the time in milliseconds of
+///
+///  - passes: one mTxmq pass over the whole tensor per dimension, which is
+///    what fast_transform does with tensors that fit in cache
+///  - fused: fused_transform
+///  - inner: a call of inner() per dimension, as general_transform did
+///  - dir: a call of transform_dir() per dimension
+///
+///     bench_transform [maxsize]
+///
+/// Tensors with more than maxsize elements (default 2^22) are skipped.
+
+#include <madness/madness_config.h>
+#include <madness/tensor/tensor.h>
+#include <madness/world/timers.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+
+using namespace madness;
+
+/// Transforms with one pass over the tensor per dimension
+void passes(const Tensor<double>& t, const Tensor<double>& c, Tensor<double>& result, Tensor<double>& work) {
+    double *t0=work.ptr(), *t1=result.ptr();
+    if (t.ndim()&1) std::swap(t0,t1);
+    const long dimj = c.dim(1);
+    long dimi = 1;
+    for (int n=1; n<t.ndim(); ++n) dimi *= dimj;
+    mTxmq(dimi, dimj, dimj, t0, t.ptr(), c.ptr());
+    for (int n=1; n<t.ndim(); ++n) {
+        mTxmq(dimi, dimj, dimj, t1, t0, c.ptr());
+        std::swap(t0,t1);
+    }
+}
+
+/// Transforms with a call of inner() per dimension
+Tensor<double> by_inner(const Tensor<double>& t, const Tensor<double>& c) {
+    Tensor<double> result = t;
+    for (long d=0; d<t.ndim(); ++d) result = inner(result,c,0,0);
+    return result;
+}
+
+/// Transforms with a call of transform_dir() per dimension
+Tensor<double> by_dir(const Tensor<double>& t, const Tensor<double>& c) {
+    Tensor<double> result = t;
+    for (long d=0; d<t.ndim(); ++d) result = transform_dir(result,c,d);
+    return result;
+}
+
+/// Returns the shortest time in ms over trials that each repeat a method for at least 50ms
+double timer(int method, const Tensor<double>& t, const Tensor<double> c[],
+             Tensor<double>& result, Tensor<double>& work) {
+    double fastest = 1e99;
+    for (int trial=0; trial<3; ++trial) {
+        long nloop = 0;
+        const double start = wall_time();
+        double used;
+        do {
+            switch (method) {
+            case 0: passes(t, c[0], result, work); break;
+            case 1: fused_transform(t, c, result, work); break;
+            case 2: by_inner(t, c[0]); break;
+            case 3: by_dir(t, c[0]); break;
+            }
+            ++nloop;
+            used = wall_time() - start;
+        } while (used < 0.05);
+        fastest = std::min(fastest, 1e3*used/nloop);
+    }
+    return fastest;
+}
+
+int main(int argc, char** argv) {
+    const double maxsize = (argc > 1) ? atof(argv[1]) : double(1l<<22);
+
+    printf("ndim    k   passes    fused    inner      dir   (ms)\n");
+    const int ndims[] = {3, 6};
+    for (int i=0; i<2; ++i) {
+        const int ndim = ndims[i];
+        for (long k=6; k<=32; k+=2) {
+            if (std::pow(double(k),ndim) > maxsize) continue;
+            std::vector<long> dims(ndim,k);
+            Tensor<double> t(ndim,&dims[0]), result(ndim,&dims[0]), work(ndim,&dims[0]);
+            Tensor<double> c(k,k);
+            t.fillrandom();
+            c.fillrandom();
+            std::vector< Tensor<double> > cs(ndim,c);
+
+            printf("%4d %4ld", ndim, k);
+            for (int method=0; method<4; ++method) printf(" %8.3f", timer(method, t, &cs[0], result, work));
+            printf("\n");
+            fflush(stdout);
+        }
+    }
+    return 0;
+}
@@ -223,6 +223,20 @@ namespace madness {
 	    return result;
     }
 
+    template <class T>
+	GenTensor<T> reduce_randomized(std::list<GenTensor<T> >& addends, double eps) {
+    	typedef typename std::list<GenTensor<T> >::iterator iterT;
+    	if (addends.size()==0) return GenTensor<T>();
+    	long k=0;
+    	for (iterT it=addends.begin(); it!=addends.end(); ++it) k=std::max(k,it->dim(0));
+    	GenTensor<T> result(std::vector<long>(addends.front().ndim(),k),TT_FULL);
+    	for (iterT it=addends.begin(); it!=addends.end(); ++it) {
+    		result(std::vector<Slice>(it->ndim(),Slice(0,it->dim(0)-1)))+=*it;
+    	}
+    	addends.clear();
+	    return result;
+    }
+
     /// Outer product ... result(i,j,...,p,q,...) = left(i,k,...)*right(p,q,...)
 
     /// \ingroup tensor
@@ -1203,6 +1217,61 @@ namespace madness {
     	return result;
     }
 
+    /// add all the GenTensors of a given list, reducing the rank only once
+
+    /// The configurations of all addends are concatenated into a single SRConf,
+    /// whose rank is then reduced with a randomized SVD (see ortho_randomized).
+    /// This is much cheaper than reduce if there are many addends and the rank
+    /// of the sum is small, as for the separated terms of an integral operator.
+    /// Addends with a smaller k are added to the leading block of the result,
+    /// e.g. the sum coefficients of a tensor in NS form.
+    /// @param[in]	addends		a list with gentensors in SVD form; will be destroyed upon return
+    /// @param[in]	eps			the accuracy threshold
+    ///	@return		the sum GenTensor of the input GenTensors
+    template<typename T>
+	GenTensor<T> reduce_randomized(std::list<GenTensor<T> >& addends, double eps) {
+
+    	typedef typename std::list<GenTensor<T> >::const_iterator iterT;
+
+    	// remove zero ranks and get the dimensions of the result
+		addends.remove_if(has_zero_rank<T>);
+    	if (addends.size()==0) return GenTensor<T>();
+
+    	long rank=0, k=0;
+    	for (iterT it=addends.begin(); it!=addends.end(); ++it) {
+    		MADNESS_ASSERT(it->tensor_type()==TT_2D);
+    		MADNESS_ASSERT(it->config().has_structure());
+    		rank+=it->rank();
+    		k=std::max(k,long(it->get_k()));
+    	}
+    	const long dim=addends.front().dim();
+    	const int dim_pv=addends.front().config().dim_per_vector();
+
+    	// concatenate the configurations
+    	std::vector<long> vdim(dim_pv+1,k);
+    	vdim[0]=rank;
+    	Tensor<T> v0(vdim), v1(vdim);
+    	Tensor<double> weights(rank);
+    	long r0=0;
+    	for (iterT it=addends.begin(); it!=addends.end(); ++it) {
+    		const long r1=r0+it->rank();
+    		std::vector<Slice> s(dim_pv+1,Slice(0,it->get_k()-1));
+    		s[0]=Slice(0,it->rank()-1);
+    		std::vector<Slice> s_result(s);
+    		s_result[0]=Slice(r0,r1-1);
+    		v0(s_result)=it->config().ref_vector(0)(s);
+    		v1(s_result)=it->config().ref_vector(1)(s);
+    		weights(Slice(r0,r1-1))=it->config().weights_(Slice(0,it->rank()-1));
+    		r0=r1;
+    	}
+    	addends.clear();
+
+    	const long kvec=v0.size()/rank;
+    	GenTensor<T> result(SRConf<T>(weights,v0.reshape(rank,kvec),v1.reshape(rank,kvec),dim,k));
+    	result.config().orthonormalize_randomized(eps*GenTensor<T>::fac_reduce());
+    	return result;
+    }
+
     /// Transforms one dimension of the tensor t by the matrix c, returns new contiguous tensor
 
     /// \ingroup tensor
@@ -123,9 +123,16 @@ extern "C" void TmTxm2(long dimi, long dimj, long dimk,
 
 namespace madness {
 
+    // On x86-64 mTxmq dispatches at runtime (see mtxmq_simd.cc) and this
+    // is only its SSE3 kernel
+#if defined(X86_64) && !defined(DISABLE_SSE3)
+    void mTxmq_sse(const long dimi, const long dimj, const long dimk,
+                   double* restrict c, const double* a, const double* b) {
+#else
     template<>
     void mTxmq(const long dimi, const long dimj, const long dimk,
                double* restrict c, const double* a, const double* b) {
+#endif
         //PROFILE_BLOCK(mTxmq_double_asm);
         //std::cout << "IN DOUBLE ASM VERSION " << dimi << " " << dimj << " " << dimk << "\n";
 
@@ -321,9 +328,8 @@ namespace madness {
 
 #if defined(X86_64)  && !defined(DISABLE_SSE3)
 namespace madness {
-    template <>
-    void mTxmq(const long dimi, const long dimj, const long dimk,
-               double_complex* restrict c, const double_complex* a, const double_complex* b) {
+    void mTxmq_sse(const long dimi, const long dimj, const long dimk,
+                   double_complex* restrict c, const double_complex* a, const double_complex* b) {
 
         //PROFILE_BLOCK(mTxmq_complex_asm);
         const long dimi16 = dimi<<4;
@@ -769,9 +775,8 @@ namespace madness {
     }
 
 #ifndef __INTEL_COMPILER
-    template <>
-    void mTxmq(const long dimi, const long dimj, const long dimk,
-               double_complex* restrict c, const double_complex* a, const double* b)
+    void mTxmq_sse(const long dimi, const long dimj, const long dimk,
+                   double_complex* restrict c, const double_complex* a, const double* b)
     {
       const long itile = 14;
       for (long ilo = 0; ilo < dimi; ilo += itile, a+=itile, c+=itile*dimj)
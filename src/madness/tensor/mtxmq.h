@@ -34,10 +34,48 @@
 #define MADNESS_TENSOR_MTXMQ_H__INCLUDED
 
 #include <madness/madness_config.h>
+#include <complex>
 
 typedef std::complex<double> double_complex;
+typedef std::complex<float> float_complex;
 
 namespace madness {
+
+    /// Instruction sets for which mTxmq has kernels, in increasing order of preference
+
+    /// On x86-64 mTxmq picks its kernel at runtime from cpuid, so one
+    /// build uses the widest vector unit of each node it runs on.
+    /// MTXMQ_SSE is the original assembler for double precision, which
+    /// is only fast for even dimensions and aligned data.  The AVX2 and
+    /// AVX-512 kernels have no restrictions.  MTXMQ_GENERIC is the
+    /// reference loop below, used on all other platforms.  Setting the
+    /// environment variable \c MAD_MTXMQ_ISA to the name of an instruction
+    /// set limits the selection, e.g., for debugging.
+    enum mTxmqISA {MTXMQ_GENERIC, MTXMQ_SSE, MTXMQ_AVX2, MTXMQ_AVX512};
+
+    /// Returns the instruction set whose kernels mTxmq currently uses
+    mTxmqISA mTxmq_isa();
+
+    /// Selects the instruction set used by mTxmq, e.g., to compare kernels
+
+    /// An instruction set the host does not support is replaced by the
+    /// best one it does.  The selection is global and must not be changed
+    /// while other threads are computing.
+    /// @return the instruction set actually selected
+    mTxmqISA set_mTxmq_isa(mTxmqISA isa);
+
+    /// Returns the name of an instruction set as used by \c MAD_MTXMQ_ISA
+    const char* mTxmq_isa_name(mTxmqISA isa);
+
+    /// Enables or disables the kernels compiled for fixed sizes
+
+    /// The AVX2 and AVX-512 kernels have variants for dimj = dimk = ldb
+    /// fixed at compile time, for the sizes of the transforms with the
+    /// common wavelet orders: n = 6, 8, ..., 16 and 2n.  They are found by
+    /// a table lookup on the size and are enabled by default; disabling
+    /// them is only useful to measure what they gain.
+    /// @return the previous setting
+    bool set_mTxmq_fixed(bool enable);
     /// Matrix = Matrix transpose * matrix ... reference implementation
     /// Does \c C=AT*B whereas mTxm does C=C+AT*B.  It also supposed
     /// to be fast which it achieves thru restrictions
@@ -172,6 +210,8 @@ namespace madness {
     }
 
 #elif defined(X86_64) && !defined(DISABLE_SSE3)
+    // These dispatch at runtime to the kernels in mtxmq_simd.cc and
+    // accept any dimensions and alignment
     template <>
     void mTxmq(long dimi, long dimj, long dimk,
                double* restrict c, const double* a, const double* b);
@@ -186,6 +226,42 @@ namespace madness {
                double_complex* restrict c, const double_complex* a, const double* b);
 #endif
 
+    template <>
+    void mTxmq(long dimi, long dimj, long dimk,
+               double_complex* restrict c, const double* a, const double_complex* b);
+
+    template <>
+    void mTxmq(long dimi, long dimj, long dimk,
+               float* restrict c, const float* a, const float* b);
+
+    template <>
+    void mTxmq(long dimi, long dimj, long dimk,
+               float_complex* restrict c, const float_complex* a, const float_complex* b);
+
+    template <>
+    void mTxmq(long dimi, long dimj, long dimk,
+               float_complex* restrict c, const float_complex* a, const float* b);
+
+    template <>
+    void mTxmq(long dimi, long dimj, long dimk,
+               float_complex* restrict c, const float* a, const float_complex* b);
+
+    template <>
+    void mTxmq_padding(long dimi, long dimj, long dimk, long ext_b,
+                       double* c, const double* a, const double* b);
+
+    template <>
+    void mTxmq_padding(long dimi, long dimj, long dimk, long ext_b,
+                       double_complex* c, const double_complex* a, const double_complex* b);
+
+    template <>
+    void mTxmq_padding(long dimi, long dimj, long dimk, long ext_b,
+                       double_complex* c, const double_complex* a, const double* b);
+
+    template <>
+    void mTxmq_padding(long dimi, long dimj, long dimk, long ext_b,
+                       double_complex* c, const double* a, const double_complex* b);
+
 #elif defined(X86_32)
     template <>
     void mTxmq(long dimi, long dimj, long dimk,
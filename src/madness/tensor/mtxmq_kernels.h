@@ -0,0 +1,379 @@
+/*
+  This file is part of MADNESS.
+
+  Copyright (C) 2007,2010 Oak Ridge National Laboratory
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+
+  For more information please contact:
+
+  Robert J. Harrison
+  Oak Ridge National Laboratory
+  One Bethel Valley Road
+  P.O. Box 2008, MS-6367
+
+  email: harrisonrj@ornl.gov
+  tel:   865-241-3937
+  fax:   865-572-0680
+
+  $Id$
+*/
+
+// Register-blocked mTxmq kernels written against a SIMD traits class.
+//
+// There is deliberately no include guard.  mtxmq_simd.cc includes this
+// file once per instruction set, inside a namespace and a matching
+// "#pragma GCC target" region that also defines the traits classes
+// vdouble and vfloat.  Every function below thus inherits the target
+// of the region it is included into, which is what lets one binary
+// carry kernels for several instruction sets.  The includer also
+// defines MTXMQ_UNROLL, placed before the loops that must be fully
+// unrolled, and mtxmq_max_fixed, the largest size in fixed_kernels.
+//
+// A traits class V provides the element type T, the vector type vec,
+// the lane mask type mask, the number of lanes width, the number of
+// rows mr (real) and mrc (complex) held in registers, and
+//
+//    zero()               all lanes zero
+//    broadcast(p)         all lanes p[0]
+//    broadcast_pair(p)    lanes alternate p[0],p[1]
+//    load(p), load(p,m)   unaligned load, masked load of the lanes in m
+//    load_half(p)         the lower width/2 lanes from p
+//    store(p,v), store(p,v,m)
+//    fma(a,b,c)           a*b+c
+//    swap_pairs(v)        exchanges neighboring lanes
+//    addsub(a,b)          a-b in even lanes, a+b in odd lanes
+//    dup(v)               lanes 0,0,1,1,2,2,... of v
+//    make_mask(n)         the first n lanes
+//
+// All kernels compute c(i,j) = sum(k) a(k,i)*b(k,j) with the rows of
+// b separated by ldb elements.  Columns that do not fill a vector are
+// handled with masked loads and stores, so there are no restrictions
+// on the dimensions or on the alignment of the data.
+//
+// The dimensions are template parameters, either long or fixed_dim<N>,
+// so the same code also yields kernels for sizes known at compile time.
+
+/// Real kernel, also used for real a times complex b
+template <typename V, int MR>
+struct real_block {
+    typedef typename V::T T;
+    typedef typename V::vec vec;
+    typedef typename V::mask mask;
+
+    template <int NV, bool MASK, typename K, typename LB, typename LC>
+    static inline void tile(K dimk, long lda, LB ldb, LC ldc,
+                            T* c, const T* a, const T* b, mask m) {
+        vec acc[MR][NV];
+        MTXMQ_UNROLL
+        for (int r=0; r<MR; ++r)
+            MTXMQ_UNROLL
+            for (int v=0; v<NV; ++v) acc[r][v] = V::zero();
+
+        for (long k=0; k<dimk; ++k, a+=lda, b+=ldb) {
+            vec bk[NV];
+            MTXMQ_UNROLL
+            for (int v=0; v<NV; ++v)
+                bk[v] = (MASK && v==NV-1) ? V::load(b+v*V::width,m) : V::load(b+v*V::width);
+            MTXMQ_UNROLL
+            for (int r=0; r<MR; ++r) {
+                const vec ar = V::broadcast(a+r);
+                MTXMQ_UNROLL
+                for (int v=0; v<NV; ++v) acc[r][v] = V::fma(ar,bk[v],acc[r][v]);
+            }
+        }
+
+        MTXMQ_UNROLL
+        for (int r=0; r<MR; ++r, c+=ldc) {
+            MTXMQ_UNROLL
+            for (int v=0; v<NV; ++v) {
+                if (MASK && v==NV-1) V::store(c+v*V::width,acc[r][v],m);
+                else V::store(c+v*V::width,acc[r][v]);
+            }
+        }
+    }
+
+    /// MR rows of c with ncol columns
+    template <typename K, typename LB, typename LC, typename N>
+    static void apply(K dimk, long lda, LB ldb, LC ldc, N ncol,
+                      T* c, const T* a, const T* b) {
+        const long w = V::width;
+        const mask full = V::make_mask(w);
+        long j = 0;
+        for (; j+2*w<=ncol; j+=2*w) tile<2,false>(dimk,lda,ldb,ldc,c+j,a,b+j,full);
+        const long n = ncol-j;
+        if (n > w) tile<2,true>(dimk,lda,ldb,ldc,c+j,a,b+j,V::make_mask(n-w));
+        else if (n == w) tile<1,false>(dimk,lda,ldb,ldc,c+j,a,b+j,full);
+        else if (n > 0) tile<1,true>(dimk,lda,ldb,ldc,c+j,a,b+j,V::make_mask(n));
+    }
+};
+
+
+/// Complex kernel on interleaved real and imaginary parts
+
+/// The products of the real and imaginary parts of a are accumulated
+/// separately and combined with a single addsub at the end.
+template <typename V, int MR>
+struct complex_block {
+    typedef typename V::T T;
+    typedef typename V::vec vec;
+    typedef typename V::mask mask;
+
+    template <int NV, bool MASK, typename K, typename LB, typename LC>
+    static inline void tile(K dimk, long lda, LB ldb, LC ldc,
+                            T* c, const T* a, const T* b, mask m) {
+        vec re[MR][NV], im[MR][NV];
+        MTXMQ_UNROLL
+        for (int r=0; r<MR; ++r) {
+            MTXMQ_UNROLL
+            for (int v=0; v<NV; ++v) re[r][v] = im[r][v] = V::zero();
+        }
+
+        for (long k=0; k<dimk; ++k, a+=lda, b+=ldb) {
+            vec bk[NV], bs[NV];
+            MTXMQ_UNROLL
+            for (int v=0; v<NV; ++v) {
+                bk[v] = (MASK && v==NV-1) ? V::load(b+v*V::width,m) : V::load(b+v*V::width);
+                bs[v] = V::swap_pairs(bk[v]);
+            }
+            MTXMQ_UNROLL
+            for (int r=0; r<MR; ++r) {
+                const vec ar = V::broadcast(a+2*r);
+                const vec ai = V::broadcast(a+2*r+1);
+                MTXMQ_UNROLL
+                for (int v=0; v<NV; ++v) {
+                    re[r][v] = V::fma(ar,bk[v],re[r][v]);
+                    im[r][v] = V::fma(ai,bs[v],im[r][v]);
+                }
+            }
+        }
+
+        MTXMQ_UNROLL
+        for (int r=0; r<MR; ++r, c+=ldc) {
+            MTXMQ_UNROLL
+            for (int v=0; v<NV; ++v) {
+                const vec s = V::addsub(re[r][v],im[r][v]);
+                if (MASK && v==NV-1) V::store(c+v*V::width,s,m);
+                else V::store(c+v*V::width,s);
+            }
+        }
+    }
+
+    template <typename K, typename LB, typename LC, typename N>
+    static void apply(K dimk, long lda, LB ldb, LC ldc, N ncol,
+                      T* c, const T* a, const T* b) {
+        const long w = V::width;
+        const mask full = V::make_mask(w);
+        long j = 0;
+        for (; j+2*w<=ncol; j+=2*w) tile<2,false>(dimk,lda,ldb,ldc,c+j,a,b+j,full);
+        const long n = ncol-j;
+        if (n > w) tile<2,true>(dimk,lda,ldb,ldc,c+j,a,b+j,V::make_mask(n-w));
+        else if (n == w) tile<1,false>(dimk,lda,ldb,ldc,c+j,a,b+j,full);
+        else if (n > 0) tile<1,true>(dimk,lda,ldb,ldc,c+j,a,b+j,V::make_mask(n));
+    }
+};
+
+
+/// Complex a times real b
+
+/// Each vector of c holds width/2 complex numbers, computed from width/2
+/// elements of b duplicated into both lanes of a pair.
+template <typename V, int MR>
+struct mixed_block {
+    typedef typename V::T T;
+    typedef typename V::vec vec;
+    typedef typename V::mask mask;
+
+    template <int NV, bool MASK, typename K, typename LB, typename LC>
+    static inline void tile(K dimk, long lda, LB ldb, LC ldc,
+                            T* c, const T* a, const T* b, mask mc, mask mb) {
+        const long h = V::width/2;
+        vec acc[MR][NV];
+        MTXMQ_UNROLL
+        for (int r=0; r<MR; ++r)
+            MTXMQ_UNROLL
+            for (int v=0; v<NV; ++v) acc[r][v] = V::zero();
+
+        for (long k=0; k<dimk; ++k, a+=lda, b+=ldb) {
+            vec bk[NV];
+            MTXMQ_UNROLL
+            for (int v=0; v<NV; ++v)
+                bk[v] = V::dup((MASK && v==NV-1) ? V::load(b+v*h,mb) : V::load_half(b+v*h));
+            MTXMQ_UNROLL
+            for (int r=0; r<MR; ++r) {
+                const vec ar = V::broadcast_pair(a+2*r);
+                MTXMQ_UNROLL
+                for (int v=0; v<NV; ++v) acc[r][v] = V::fma(ar,bk[v],acc[r][v]);
+            }
+        }
+
+        MTXMQ_UNROLL
+        for (int r=0; r<MR; ++r, c+=ldc) {
+            MTXMQ_UNROLL
+            for (int v=0; v<NV; ++v) {
+                if (MASK && v==NV-1) V::store(c+v*V::width,acc[r][v],mc);
+                else V::store(c+v*V::width,acc[r][v]);
+            }
+        }
+    }
+
+    /// ncol counts the real and imaginary parts of c
+    template <typename K, typename LB, typename LC, typename N>
+    static void apply(K dimk, long lda, LB ldb, LC ldc, N ncol,
+                      T* c, const T* a, const T* b) {
+        const long w = V::width;
+        const mask full = V::make_mask(w);
+        long j = 0;
+        for (; j+2*w<=ncol; j+=2*w) tile<2,false>(dimk,lda,ldb,ldc,c+j,a,b+j/2,full,full);
+        const long n = ncol-j;
+        if (n > w) tile<2,true>(dimk,lda,ldb,ldc,c+j,a,b+j/2,V::make_mask(n-w),V::make_mask((n-w)/2));
+        else if (n == w) tile<1,false>(dimk,lda,ldb,ldc,c+j,a,b+j/2,full,full);
+        else if (n > 0) tile<1,true>(dimk,lda,ldb,ldc,c+j,a,b+j/2,V::make_mask(n),V::make_mask(n/2));
+    }
+};
+
+
+/// Runs Block over all rows of c, MR rows at a time and then the remainder
+
+/// \c astep is the number of elements of \c T per element of \c a
+template <template <typename,int> class Block, typename V, int MR,
+          typename K, typename LB, typename LC, typename N>
+static void rows(long dimi, K dimk, long lda, LB ldb, LC ldc, N ncol, long astep,
+                 typename V::T* c, const typename V::T* a, const typename V::T* b) {
+    long i = 0;
+    for (; i+MR<=dimi; i+=MR) Block<V,MR>::apply(dimk,lda,ldb,ldc,ncol,c+i*ldc,a+i*astep,b);
+    if (MR>4 && dimi-i>=4) {
+        Block<V,4>::apply(dimk,lda,ldb,ldc,ncol,c+i*ldc,a+i*astep,b);
+        i += 4;
+    }
+    if (MR>2 && dimi-i>=2) {
+        Block<V,2>::apply(dimk,lda,ldb,ldc,ncol,c+i*ldc,a+i*astep,b);
+        i += 2;
+    }
+    if (MR>1 && dimi-i>=1) Block<V,1>::apply(dimk,lda,ldb,ldc,ncol,c+i*ldc,a+i*astep,b);
+}
+
+
+/// A dimension known at compile time, used in place of a long
+
+/// Kernels instantiated with fixed dimensions have constant loop
+/// bounds, strides and column masks, so the compiler unrolls the loop
+/// over k and drops the tests for partial tiles.
+template <long N>
+struct fixed_dim {
+    operator long() const {return N;}
+};
+
+static inline long twice(long n) {return 2*n;}
+
+template <long N>
+static inline fixed_dim<2*N> twice(fixed_dim<N>) {return fixed_dim<2*N>();}
+
+
+// The entry points, one per combination of types mTxmq is specialized for
+
+template <typename J, typename K, typename L>
+static void mtxmq(long dimi, J dimj, K dimk, L ldb,
+                  double* c, const double* a, const double* b) {
+    rows<real_block,vdouble,vdouble::mr>(dimi, dimk, dimi, ldb, dimj, dimj, 1, c, a, b);
+}
+
+template <typename J, typename K, typename L>
+static void mtxmq(long dimi, J dimj, K dimk, L ldb,
+                  double_complex* c, const double_complex* a, const double_complex* b) {
+    rows<complex_block,vdouble,vdouble::mrc>(dimi, dimk, 2*dimi, twice(ldb), twice(dimj), twice(dimj), 2,
+                                             (double*) c, (const double*) a, (const double*) b);
+}
+
+template <typename J, typename K, typename L>
+static void mtxmq(long dimi, J dimj, K dimk, L ldb,
+                  double_complex* c, const double_complex* a, const double* b) {
+    rows<mixed_block,vdouble,vdouble::mr>(dimi, dimk, 2*dimi, ldb, twice(dimj), twice(dimj), 2,
+                                          (double*) c, (const double*) a, b);
+}
+
+template <typename J, typename K, typename L>
+static void mtxmq(long dimi, J dimj, K dimk, L ldb,
+                  double_complex* c, const double* a, const double_complex* b) {
+    rows<real_block,vdouble,vdouble::mr>(dimi, dimk, dimi, twice(ldb), twice(dimj), twice(dimj), 1,
+                                         (double*) c, a, (const double*) b);
+}
+
+template <typename J, typename K, typename L>
+static void mtxmq(long dimi, J dimj, K dimk, L ldb,
+                  float* c, const float* a, const float* b) {
+    rows<real_block,vfloat,vfloat::mr>(dimi, dimk, dimi, ldb, dimj, dimj, 1, c, a, b);
+}
+
+template <typename J, typename K, typename L>
+static void mtxmq(long dimi, J dimj, K dimk, L ldb,
+                  float_complex* c, const float_complex* a, const float_complex* b) {
+    rows<complex_block,vfloat,vfloat::mrc>(dimi, dimk, 2*dimi, twice(ldb), twice(dimj), twice(dimj), 2,
+                                           (float*) c, (const float*) a, (const float*) b);
+}
+
+template <typename J, typename K, typename L>
+static void mtxmq(long dimi, J dimj, K dimk, L ldb,
+                  float_complex* c, const float_complex* a, const float* b) {
+    rows<mixed_block,vfloat,vfloat::mr>(dimi, dimk, 2*dimi, ldb, twice(dimj), twice(dimj), 2,
+                                        (float*) c, (const float*) a, b);
+}
+
+template <typename J, typename K, typename L>
+static void mtxmq(long dimi, J dimj, K dimk, L ldb,
+                  float_complex* c, const float* a, const float_complex* b) {
+    rows<real_block,vfloat,vfloat::mr>(dimi, dimk, dimi, twice(ldb), twice(dimj), twice(dimj), 1,
+                                       (float*) c, a, (const float*) b);
+}
+
+
+/// The kernel for dimj = dimk = ldb = N
+template <long N, typename aT, typename bT, typename cT>
+static void mtxmq_fixed(long dimi, cT* c, const aT* a, const bT* b) {
+    mtxmq(dimi, fixed_dim<N>(), fixed_dim<N>(), fixed_dim<N>(), c, a, b);
+}
+
+/// Dispatch table of the kernels for fixed sizes, indexed by the size
+
+/// The sizes are the common wavelet orders k and the 2k of the
+/// two-scale transforms.  Other sizes have a null entry.
+template <typename aT, typename bT, typename cT>
+struct fixed_kernels {
+    typedef void (*kernel)(long dimi, cT* c, const aT* a, const bT* b);
+    static const kernel table[mtxmq_max_fixed+1];
+};
+
+template <typename aT, typename bT, typename cT>
+const typename fixed_kernels<aT,bT,cT>::kernel fixed_kernels<aT,bT,cT>::table[mtxmq_max_fixed+1] = {
+    0, 0, 0, 0, 0, 0,
+    mtxmq_fixed<6,aT,bT,cT>, 0, mtxmq_fixed<8,aT,bT,cT>, 0, mtxmq_fixed<10,aT,bT,cT>, 0,
+    mtxmq_fixed<12,aT,bT,cT>, 0, mtxmq_fixed<14,aT,bT,cT>, 0, mtxmq_fixed<16,aT,bT,cT>, 0, 0, 0,
+    mtxmq_fixed<20,aT,bT,cT>, 0, 0, 0, mtxmq_fixed<24,aT,bT,cT>, 0, 0, 0,
+    mtxmq_fixed<28,aT,bT,cT>, 0, 0, 0, mtxmq_fixed<32,aT,bT,cT>
+};
+
+/// Uses the kernel for the size if there is one and \c fixed is set, else the general kernel
+template <typename aT, typename bT, typename cT>
+static void mtxmq_select(bool fixed, long dimi, long dimj, long dimk, long ldb,
+                         cT* c, const aT* a, const bT* b) {
+    if (fixed && dimj == dimk && ldb == dimj && dimj <= mtxmq_max_fixed) {
+        typename fixed_kernels<aT,bT,cT>::kernel f = fixed_kernels<aT,bT,cT>::table[dimj];
+        if (f) {
+            f(dimi, c, a, b);
+            return;
+        }
+    }
+    mtxmq(dimi, dimj, dimk, ldb, c, a, b);
+}
@@ -0,0 +1,412 @@
+/*
+  This file is part of MADNESS.
+
+  Copyright (C) 2007,2010 Oak Ridge National Laboratory
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+
+  For more information please contact:
+
+  Robert J. Harrison
+  Oak Ridge National Laboratory
+  One Bethel Valley Road
+  P.O. Box 2008, MS-6367
+
+  email: harrisonrj@ornl.gov
+  tel:   865-241-3937
+  fax:   865-572-0680
+
+  $Id$
+*/
+#include <madness/madness_config.h>
+#include <madness/tensor/mtxmq.h>
+#include <cstdlib>
+#include <cstring>
+
+// On x86-64 mTxmq selects its kernel at runtime.  The AVX2 and AVX-512
+// kernels are compiled with target pragmas rather than with compiler
+// flags, so a single build carries all of them and uses the widest one
+// the host supports.  Without GCC-compatible target support only the
+// SSE3 assembler in mtxmq.cc and the generic loop are available.
+
+#if defined(X86_64) && !defined(DISABLE_SSE3)
+#  define MADNESS_MTXMQ_X86_64 1
+#  if defined(__GNUC__) && !defined(__INTEL_COMPILER)
+#    define MADNESS_MTXMQ_DISPATCH 1
+#    include <immintrin.h>
+#  endif
+#endif
+
+namespace madness {
+
+#ifdef MADNESS_MTXMQ_X86_64
+
+    // The SSE3 assembler kernels in mtxmq.cc
+    void mTxmq_sse(long dimi, long dimj, long dimk,
+                   double* restrict c, const double* a, const double* b);
+    void mTxmq_sse(long dimi, long dimj, long dimk,
+                   double_complex* restrict c, const double_complex* a, const double_complex* b);
+#ifndef __INTEL_COMPILER
+    void mTxmq_sse(long dimi, long dimj, long dimk,
+                   double_complex* restrict c, const double_complex* a, const double* b);
+#endif
+
+#ifdef MADNESS_MTXMQ_DISPATCH
+
+    // The loops over the rows and vectors of a register tile must be
+    // unrolled for the accumulators to be kept in registers, which GCC
+    // does not do by itself below -O3
+#define MTXMQ_UNROLL _Pragma("GCC unroll 8")
+
+    /// Largest dimension with a kernel compiled for its size
+    static const long mtxmq_max_fixed = 32;
+
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+    namespace avx2 {
+
+        struct vdouble {
+            typedef double T;
+            typedef __m256d vec;
+            typedef __m256i mask;
+            static const int width = 4;
+            static const int mr = 6;
+            static const int mrc = 2;
+
+            static inline vec zero() {return _mm256_setzero_pd();}
+            static inline vec broadcast(const T* p) {return _mm256_broadcast_sd(p);}
+            static inline vec broadcast_pair(const T* p) {return _mm256_broadcast_pd((const __m128d*) p);}
+            static inline vec load(const T* p) {return _mm256_loadu_pd(p);}
+            static inline vec load(const T* p, mask m) {return _mm256_maskload_pd(p,m);}
+            static inline vec load_half(const T* p) {return _mm256_castpd128_pd256(_mm_loadu_pd(p));}
+            static inline void store(T* p, vec v) {_mm256_storeu_pd(p,v);}
+            static inline void store(T* p, vec v, mask m) {_mm256_maskstore_pd(p,m,v);}
+            static inline vec fma(vec a, vec b, vec c) {return _mm256_fmadd_pd(a,b,c);}
+            static inline vec swap_pairs(vec v) {return _mm256_permute_pd(v,0x5);}
+            static inline vec addsub(vec a, vec b) {return _mm256_addsub_pd(a,b);}
+            static inline vec dup(vec v) {return _mm256_permute4x64_pd(v,0x50);}
+            static inline mask make_mask(long n) {
+                return _mm256_cmpgt_epi64(_mm256_set1_epi64x(n), _mm256_setr_epi64x(0,1,2,3));
+            }
+        };
+
+        struct vfloat {
+            typedef float T;
+            typedef __m256 vec;
+            typedef __m256i mask;
+            static const int width = 8;
+            static const int mr = 6;
+            static const int mrc = 2;
+
+            static inline vec zero() {return _mm256_setzero_ps();}
+            static inline vec broadcast(const T* p) {return _mm256_broadcast_ss(p);}
+            static inline vec broadcast_pair(const T* p) {
+                return _mm256_castpd_ps(_mm256_broadcast_sd((const double*) p));
+            }
+            static inline vec load(const T* p) {return _mm256_loadu_ps(p);}
+            static inline vec load(const T* p, mask m) {return _mm256_maskload_ps(p,m);}
+            static inline vec load_half(const T* p) {return _mm256_castps128_ps256(_mm_loadu_ps(p));}
+            static inline void store(T* p, vec v) {_mm256_storeu_ps(p,v);}
+            static inline void store(T* p, vec v, mask m) {_mm256_maskstore_ps(p,m,v);}
+            static inline vec fma(vec a, vec b, vec c) {return _mm256_fmadd_ps(a,b,c);}
+            static inline vec swap_pairs(vec v) {return _mm256_permute_ps(v,0xb1);}
+            static inline vec addsub(vec a, vec b) {return _mm256_addsub_ps(a,b);}
+            static inline vec dup(vec v) {
+                return _mm256_permutevar8x32_ps(v, _mm256_setr_epi32(0,0,1,1,2,2,3,3));
+            }
+            static inline mask make_mask(long n) {
+                return _mm256_cmpgt_epi32(_mm256_set1_epi32(n), _mm256_setr_epi32(0,1,2,3,4,5,6,7));
+            }
+        };
+
+#include "mtxmq_kernels.h"
+
+    }
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+    namespace avx512 {
+
+        struct vdouble {
+            typedef double T;
+            typedef __m512d vec;
+            typedef __mmask8 mask;
+            static const int width = 8;
+            static const int mr = 8;
+            static const int mrc = 4;
+
+            static inline vec zero() {return _mm512_setzero_pd();}
+            static inline vec broadcast(const T* p) {return _mm512_set1_pd(*p);}
+            static inline vec broadcast_pair(const T* p) {
+                return _mm512_broadcast_f64x4(_mm256_broadcast_pd((const __m128d*) p));
+            }
+            static inline vec load(const T* p) {return _mm512_loadu_pd(p);}
+            static inline vec load(const T* p, mask m) {return _mm512_maskz_loadu_pd(m,p);}
+            static inline vec load_half(const T* p) {return _mm512_castpd256_pd512(_mm256_loadu_pd(p));}
+            static inline void store(T* p, vec v) {_mm512_storeu_pd(p,v);}
+            static inline void store(T* p, vec v, mask m) {_mm512_mask_storeu_pd(p,m,v);}
+            static inline vec fma(vec a, vec b, vec c) {return _mm512_fmadd_pd(a,b,c);}
+            static inline vec swap_pairs(vec v) {return _mm512_permute_pd(v,0x55);}
+            static inline vec addsub(vec a, vec b) {return _mm512_fmaddsub_pd(_mm512_set1_pd(1.0),a,b);}
+            static inline vec dup(vec v) {
+                return _mm512_permutexvar_pd(_mm512_setr_epi64(0,0,1,1,2,2,3,3), v);
+            }
+            static inline mask make_mask(long n) {return mask((1u<<n)-1);}
+        };
+
+        struct vfloat {
+            typedef float T;
+            typedef __m512 vec;
+            typedef __mmask16 mask;
+            static const int width = 16;
+            static const int mr = 8;
+            static const int mrc = 4;
+
+            static inline vec zero() {return _mm512_setzero_ps();}
+            static inline vec broadcast(const T* p) {return _mm512_set1_ps(*p);}
+            static inline vec broadcast_pair(const T* p) {
+                return _mm512_castpd_ps(_mm512_broadcastsd_pd(_mm_load_sd((const double*) p)));
+            }
+            static inline vec load(const T* p) {return _mm512_loadu_ps(p);}
+            static inline vec load(const T* p, mask m) {return _mm512_maskz_loadu_ps(m,p);}
+            static inline vec load_half(const T* p) {return _mm512_castps256_ps512(_mm256_loadu_ps(p));}
+            static inline void store(T* p, vec v) {_mm512_storeu_ps(p,v);}
+            static inline void store(T* p, vec v, mask m) {_mm512_mask_storeu_ps(p,m,v);}
+            static inline vec fma(vec a, vec b, vec c) {return _mm512_fmadd_ps(a,b,c);}
+            static inline vec swap_pairs(vec v) {return _mm512_permute_ps(v,0xb1);}
+            static inline vec addsub(vec a, vec b) {return _mm512_fmaddsub_ps(_mm512_set1_ps(1.0f),a,b);}
+            static inline vec dup(vec v) {
+                return _mm512_permutexvar_ps(_mm512_setr_epi32(0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7), v);
+            }
+            static inline mask make_mask(long n) {return mask((1u<<n)-1);}
+        };
+
+#include "mtxmq_kernels.h"
+
+    }
+#pragma GCC pop_options
+
+#endif // MADNESS_MTXMQ_DISPATCH
+
+#endif // MADNESS_MTXMQ_X86_64
+
+    namespace {
+
+        /// The portable loop, as in mtxmq.h but with the rows of b separated by ldb
+        template <typename aT, typename bT, typename cT>
+        void mtxmq_generic(long dimi, long dimj, long dimk, long ldb,
+                           cT* restrict c, const aT* a, const bT* b) {
+            for (long i=0; i<dimi; ++i,c+=dimj,++a) {
+                for (long j=0; j<dimj; ++j) c[j] = 0.0;
+                const aT *aik_ptr = a;
+                for (long k=0; k<dimk; ++k,aik_ptr+=dimi) {
+                    aT aki = *aik_ptr;
+                    for (long j=0; j<dimj; ++j) {
+                        c[j] += aki*b[k*ldb+j];
+                    }
+                }
+            }
+        }
+
+        mTxmqISA best_isa() {
+#ifdef MADNESS_MTXMQ_DISPATCH
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f")) return MTXMQ_AVX512;
+            if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return MTXMQ_AVX2;
+#endif
+#ifdef MADNESS_MTXMQ_X86_64
+            return MTXMQ_SSE;
+#else
+            return MTXMQ_GENERIC;
+#endif
+        }
+
+        /// The best instruction set, optionally capped by MAD_MTXMQ_ISA
+        mTxmqISA initial_isa() {
+            mTxmqISA isa = best_isa();
+            const char* s = getenv("MAD_MTXMQ_ISA");
+            if (s) {
+                for (int i=MTXMQ_GENERIC; i<=MTXMQ_AVX512; ++i) {
+                    if (strcmp(s, mTxmq_isa_name(mTxmqISA(i))) == 0 && i < isa) isa = mTxmqISA(i);
+                }
+            }
+            return isa;
+        }
+
+        // Zero initialization before the dynamic initializer has run
+        // selects the generic loop, which is safe on any host
+        mTxmqISA current_isa = initial_isa();
+
+        /// Use the kernels compiled for fixed sizes when there is one
+        bool use_fixed = true;
+
+#ifdef MADNESS_MTXMQ_X86_64
+        /// The assembler uses aligned SSE loads and stores
+        bool is_aligned16(const void* a, const void* b, const void* c) {
+            return ((((unsigned long) a) | ((unsigned long) b) | ((unsigned long) c)) & 0xf) == 0;
+        }
+
+        template <typename aT, typename bT, typename cT>
+        bool mtxmq_sse(long dimi, long dimj, long dimk, cT* c, const aT* a, const bT* b) {
+            return false;
+        }
+
+        bool mtxmq_sse(long dimi, long dimj, long dimk, double* c, const double* a, const double* b) {
+            if (!is_aligned16(a, b, c)) return false;
+            mTxmq_sse(dimi, dimj, dimk, c, a, b);
+            return true;
+        }
+
+        bool mtxmq_sse(long dimi, long dimj, long dimk,
+                       double_complex* c, const double_complex* a, const double_complex* b) {
+            if (!is_aligned16(a, b, c)) return false;
+            mTxmq_sse(dimi, dimj, dimk, c, a, b);
+            return true;
+        }
+
+#ifndef __INTEL_COMPILER
+        bool mtxmq_sse(long dimi, long dimj, long dimk,
+                       double_complex* c, const double_complex* a, const double* b) {
+            if (!is_aligned16(a, b, c)) return false;
+            mTxmq_sse(dimi, dimj, dimk, c, a, b);
+            return true;
+        }
+#endif
+
+        template <typename aT, typename bT, typename cT>
+        void mtxmq_dispatch(long dimi, long dimj, long dimk, long ldb,
+                            cT* restrict c, const aT* a, const bT* b) {
+            switch (current_isa) {
+#ifdef MADNESS_MTXMQ_DISPATCH
+            case MTXMQ_AVX512:
+                avx512::mtxmq_select(use_fixed, dimi, dimj, dimk, ldb, c, a, b);
+                return;
+            case MTXMQ_AVX2:
+                avx2::mtxmq_select(use_fixed, dimi, dimj, dimk, ldb, c, a, b);
+                return;
+#endif
+            case MTXMQ_SSE:
+                if (ldb == dimj && mtxmq_sse(dimi, dimj, dimk, c, a, b)) return;
+                break;
+            default:
+                break;
+            }
+            mtxmq_generic(dimi, dimj, dimk, ldb, c, a, b);
+        }
+#endif // MADNESS_MTXMQ_X86_64
+
+    }
+
+    mTxmqISA mTxmq_isa() {
+        return current_isa;
+    }
+
+    mTxmqISA set_mTxmq_isa(mTxmqISA isa) {
+        const mTxmqISA best = best_isa();
+        current_isa = (isa > best) ? best : isa;
+        return current_isa;
+    }
+
+    bool set_mTxmq_fixed(bool enable) {
+        const bool previous = use_fixed;
+        use_fixed = enable;
+        return previous;
+    }
+
+    const char* mTxmq_isa_name(mTxmqISA isa) {
+        static const char* names[] = {"generic", "sse", "avx2", "avx512"};
+        return names[isa];
+    }
+
+#ifdef MADNESS_MTXMQ_X86_64
+
+    template <>
+    void mTxmq(long dimi, long dimj, long dimk,
+               double* restrict c, const double* a, const double* b) {
+        mtxmq_dispatch(dimi, dimj, dimk, dimj, c, a, b);
+    }
+
+    template <>
+    void mTxmq(long dimi, long dimj, long dimk,
+               double_complex* restrict c, const double_complex* a, const double_complex* b) {
+        mtxmq_dispatch(dimi, dimj, dimk, dimj, c, a, b);
+    }
+
+#ifndef __INTEL_COMPILER
+    template <>
+    void mTxmq(long dimi, long dimj, long dimk,
+               double_complex* restrict c, const double_complex* a, const double* b) {
+        mtxmq_dispatch(dimi, dimj, dimk, dimj, c, a, b);
+    }
+#endif
+
+    template <>
+    void mTxmq(long dimi, long dimj, long dimk,
+               double_complex* restrict c, const double* a, const double_complex* b) {
+        mtxmq_dispatch(dimi, dimj, dimk, dimj, c, a, b);
+    }
+
+    template <>
+    void mTxmq(long dimi, long dimj, long dimk,
+               float* restrict c, const float* a, const float* b) {
+        mtxmq_dispatch(dimi, dimj, dimk, dimj, c, a, b);
+    }
+
+    template <>
+    void mTxmq(long dimi, long dimj, long dimk,
+               float_complex* restrict c, const float_complex* a, const float_complex* b) {
+        mtxmq_dispatch(dimi, dimj, dimk, dimj, c, a, b);
+    }
+
+    template <>
+    void mTxmq(long dimi, long dimj, long dimk,
+               float_complex* restrict c, const float_complex* a, const float* b) {
+        mtxmq_dispatch(dimi, dimj, dimk, dimj, c, a, b);
+    }
+
+    template <>
+    void mTxmq(long dimi, long dimj, long dimk,
+               float_complex* restrict c, const float* a, const float_complex* b) {
+        mtxmq_dispatch(dimi, dimj, dimk, dimj, c, a, b);
+    }
+
+    template <>
+    void mTxmq_padding(long dimi, long dimj, long dimk, long ext_b,
+                       double* c, const double* a, const double* b) {
+        mtxmq_dispatch(dimi, dimj, dimk, ext_b, c, a, b);
+    }
+
+    template <>
+    void mTxmq_padding(long dimi, long dimj, long dimk, long ext_b,
+                       double_complex* c, const double_complex* a, const double_complex* b) {
+        mtxmq_dispatch(dimi, dimj, dimk, ext_b, c, a, b);
+    }
+
+    template <>
+    void mTxmq_padding(long dimi, long dimj, long dimk, long ext_b,
+                       double_complex* c, const double_complex* a, const double* b) {
+        mtxmq_dispatch(dimi, dimj, dimk, ext_b, c, a, b);
+    }
+
+    template <>
+    void mTxmq_padding(long dimi, long dimj, long dimk, long ext_b,
+                       double_complex* c, const double* a, const double_complex* b) {
+        mtxmq_dispatch(dimi, dimj, dimk, ext_b, c, a, b);
+    }
+
+#endif // MADNESS_MTXMQ_X86_64
+
+}
@@ -538,6 +538,31 @@ template <class T> void Test7() {
     fast_transform(x,c,r,workspace);
     if ((r-y).normf() > 1e-6*r.normf()) error("test7: failed",666);
 
+    // Big enough to be transformed in blocks, with distinct rectangular matrices
+    const long nin[] = {8,7,6,8,7,6}, nout[] = {5,7,8,8,3,6};
+    x = Tensor<T>(6,nin);
+    x.fillrandom();
+    x -= (T) 0.5;
+    Tensor<T> cs[6];
+    y = x;
+    for (int d=0; d<6; ++d) {
+        cs[d] = Tensor<T>(nin[d],nout[d]);
+        cs[d].fillrandom();
+        y = inner(y,cs[d],0,0);
+    }
+    r = general_transform(x,cs);
+    if ((r-y).normf() > 1e-5*r.normf()) error("test7: failed",777);
+
+    const long d6[] = {n,n,n,n,n,n};
+    x = Tensor<T>(6,d6);
+    x.fillrandom();
+    x -= (T) 0.5;
+    y = x;
+    for (int d=0; d<6; ++d) y = inner(y,c,0,0);
+    workspace = copy(x);
+    r = copy(x);
+    fast_transform(x,c,r,workspace);
+    if ((r-y).normf() > 1e-5*r.normf()) error("test7: failed",888);
 
     r = Tensor<T>(7,9);
     x = Tensor<T>(9);
@@ -460,6 +460,35 @@ namespace madness {
 
 		}
 
+		/// orthonormalize this, using a randomized range finder for the rank reduction
+
+		/// same result as orthonormalize, but cheaper if the rank of this is much
+		/// larger than the rank of the result, e.g. for the sum of many low-rank terms
+		void orthonormalize_randomized(const double& thresh) {
+
+			if (type()==TT_FULL) return;
+			if (has_no_data()) return;
+			if (rank()==1) {
+				normalize();
+				return;
+			}
+            normalize();
+			weights_=weights_(Slice(0,rank()-1));
+            tensorT v0=flat_vector(0);
+            tensorT v1=flat_vector(1);
+			if (not ortho_randomized(v0,v1,weights_,thresh)) {
+				divide_and_conquer_reduce(thresh);
+				return;
+			}
+            std::swap(vector_[0],v0);
+            std::swap(vector_[1],v1);
+			rank_=weights_.size();
+			MADNESS_ASSERT(rank_>=0);
+			this->make_structure();
+			make_slices();
+            MADNESS_ASSERT(has_structure());
+		}
+
 	private:
 		/// append configurations of rhs to this
 
@@ -1441,6 +1470,105 @@ namespace madness {
 		return;
 	}
 
+	/// return a (n,m) matrix of random numbers with zero mean and unit variance
+
+	/// uniformly distributed entries work as well as Gaussian ones for sampling
+	/// the range of a matrix, and the expectation value of || A g ||^2 is still
+	/// the squared Frobenius norm of A
+	inline Tensor<double> random_sampling_matrix(const long n, const long m) {
+		Tensor<double> g(n,m);
+		g.fillrandom();
+		g-=0.5;
+		g.scale(std::sqrt(12.0));
+		return g;
+	}
+
+	/// randomized version of ortho3
+
+	/// same result as ortho3 up to the threshold, but instead of building the
+	/// overlap matrices of x and y the range of the matrix A = x^T diag(w) y is
+	/// sampled with random vectors (blocked adaptive randomized range finder):
+	///  - sample a block of the range: Y = A G, with G a random (k,b) matrix
+	///  - project out the current basis Q; the norm of the remainder estimates
+	///    the range error || A - Q Q^T A ||, stop if it is small enough
+	///  - otherwise append the orthonormalized block to Q and grow the block
+	///  - SVD of the small (l,k) matrix Q^T A
+	/// operation count is O(krl + kl^2) compared to O(kr^2 + r^3) for ortho3,
+	/// with l the rank of the result plus one block of oversampling
+	///
+	/// @param[in,out]	x left subspace
+	/// @param[in,out]	y right subspace
+	/// @param[in,out]	weights weights
+	/// @param[in]		thresh	truncation threshold
+	/// @return	false if l is not much smaller than r; x, y and weights are unchanged then
+	template<typename T>
+	bool ortho_randomized(Tensor<T>& x, Tensor<T>& y, Tensor<double>& weights, const double& thresh) {
+
+		typedef Tensor<T> tensorT;
+
+		const long rank=x.dim(0);
+		const long kx=x.dim(1);
+		const long ky=y.dim(1);
+		const long minblock=8;
+
+		// randomization only pays off for sample sizes much smaller than the rank
+		const long lmax=std::min(std::min(kx,ky),rank/2);
+		if (2*minblock>lmax) return false;
+
+		// include the weights into y: A = x^T wy
+		tensorT wy=copy(y);
+		for (long r=0; r<rank; ++r) {
+			T* restrict p=wy.ptr()+r*ky;
+			for (long i=0; i<ky; ++i) p[i]*=weights(r);
+		}
+
+		// Q holds the orthonormal basis in its first l columns
+		tensorT Q(kx,lmax);
+		long l=0;
+		double err2=0.0;
+		while (true) {
+			const long b=std::max(minblock,l/2);
+			if (l+b>lmax) return false;
+
+			tensorT Y=inner(x,inner(wy,random_sampling_matrix(ky,b)),0,0);
+			if (l>0) {
+				const tensorT Ql=Q(_,Slice(0,l-1));
+				Y-=inner(Ql,inner(Ql,Y,0,0));
+
+				// the new samples are the error probe of the current basis
+				err2=Y.normf();
+				err2=err2*err2/b;
+				if (err2<0.25*thresh*thresh) break;
+
+				// reorthogonalize for numerical stability
+				Y-=inner(Ql,inner(Ql,Y,0,0));
+			}
+			tensorT R;
+			qr(Y,R);
+			Q(_,Slice(l,l+b-1))=Y;
+			l+=b;
+		}
+		Q=copy(Q(_,Slice(0,l-1)));
+
+		// project A onto the range and decompose the small matrix
+		tensorT B=inner(inner(Q,x,0,1),wy);
+		tensorT U,VT;
+		Tensor<double> s;
+		svd(B,U,s,VT);
+
+		const long i=SRConf<T>::max_sigma(std::sqrt(thresh*thresh-err2),s.dim(0),s);
+		if (i>=0) {
+			x=inner(U(_,Slice(0,i)),Q,0,1);
+			y=copy(VT(Slice(0,i),_));
+			weights=copy(s(Slice(0,i)));
+		} else {
+			x.clear();
+			y.clear();
+			weights.clear();
+		}
+		return true;
+	}
+
 	template<typename T>
 	static inline
 	std::ostream& operator<<(std::ostream& s, const SRConf<T>& sr) {
@@ -34,6 +34,8 @@ for t,q in transform_typelist:
     f.write("template Tensor<TensorResultType<%s,%s>::type> transform(const Tensor<%s>& t, const Tensor<%s>& c);\n" % (t,q,t,q))
     f.write("template Tensor<TensorResultType<%s,%s>::type> general_transform(const Tensor<%s>& t, const Tensor<%s> c[]);\n" % (t,q,t,q))
     f.write("template Tensor<TensorResultType<%s,%s>::type>& fast_transform(const Tensor<%s>& t, const Tensor<%s>& c, Tensor< TensorResultType<%s,%s>::type >& result, Tensor< TensorResultType<%s,%s>::type >& work);\n" % (t,q,t,q,t,q,t,q))
+    f.write("template Tensor<TensorResultType<%s,%s>::type>& fused_transform(const Tensor<%s>& t, const Tensor<%s> c[], Tensor< TensorResultType<%s,%s>::type >& result, Tensor< TensorResultType<%s,%s>::type >& workspace);\n" % (t,q,t,q,t,q,t,q))
+    f.write("template void fast_transform_batch(long n, const Tensor<%s> t[], const Tensor<%s>& c, Tensor< TensorResultType<%s,%s>::type > result[], Tensor< TensorResultType<%s,%s>::type >& workspace);\n" % (t,q,t,q,t,q))
 
 
 f.write("\n// Instantiations only for complex types\n")
@@ -2308,6 +2308,157 @@ namespace madness {
         }
     }
 
+
+    namespace detail {
+
+        /// How fused_transform splits the dimensions and blocks the columns
+
+        /// Dimensions h and up are transformed slab by slab, and the h
+        /// leading ones ncol columns at a time.
+        struct fused_transform_plan {
+            long h;             ///< Number of leading dimensions
+            long nI, nIout;     ///< Input and output size of the leading dimensions
+            long nJ, nJout;     ///< Input and output size of the trailing dimensions
+            long ncol;          ///< Columns per block of the leading dimensions
+            long scratch;       ///< Size of each of the two scratch buffers
+            bool inplace;       ///< If the result holds the intermediate between the two stages
+
+            /// Plans for intermediates of up to 512 KB, for elements of \c elemsize bytes
+            fused_transform_plan(long ndim, const long nin[], const long nout[], std::size_t elemsize) {
+                const long cache = (1l<<19)/elemsize;
+                const long line = std::max(1l, long(64/elemsize));
+                long big[TENSOR_MAXDIM+1];
+                big[ndim] = 1;
+                for (long d=ndim-1; d>=0; --d) big[d] = big[d+1]*std::max(nin[d],nout[d]);
+                h = 0;
+                while (h<ndim-1 && big[h]>cache) ++h;
+
+                nI = nIout = nJ = nJout = 1;
+                for (long d=0; d<h; ++d) {
+                    nI *= nin[d];
+                    nIout *= nout[d];
+                }
+                for (long d=h; d<ndim; ++d) {
+                    nJ *= nin[d];
+                    nJout *= nout[d];
+                }
+
+                // Whole cache lines of columns, since they are gathered with a stride
+                const long lead = big[0]/big[h];
+                ncol = std::min(nJout, std::max(line, (cache/lead)/line*line));
+                scratch = std::max(big[h], lead*ncol);
+                inplace = (h == 0) || (nIout >= nI);
+            }
+
+            /// The size of workspace needed
+            long workspace() const {
+                return 2*scratch + (inplace ? 0 : nI*nJout);
+            }
+        };
+
+        /// Transforms dimensions lo to hi-1 of a contiguous block with its leading dimension lo
+
+        /// Each pass contracts the leading dimension and appends the new
+        /// one, so the order of the dimensions is restored after the last
+        /// pass.  The passes alternate between \c wa and \c wb, and the
+        /// last one writes to \c out if it is not null.
+        /// @return where the result was written
+        template <typename T, typename Q, typename R>
+        R* transform_dims(long size, long lo, long hi, const long nin[], const long nout[],
+                          const T* t, const Q* const pc[], R* wa, R* wb, R* out) {
+            long dimi = size/nin[lo];
+            R* c = (lo+1==hi && out) ? out : wa;
+            mTxmq(dimi, nout[lo], nin[lo], c, t, pc[lo]);
+            size = dimi*nout[lo];
+            for (long d=lo+1; d<hi; ++d) {
+                const R* a = c;
+                c = (d+1==hi && out) ? out : ((a==wa) ? wb : wa);
+                dimi = size/nin[d];
+                mTxmq(dimi, nout[d], nin[d], c, a, pc[d]);
+                size = dimi*nout[d];
+            }
+            return c;
+        }
+
+        /// The two stages of fused_transform on raw pointers, with the workspace allocated by the caller
+        template <typename T, typename Q, typename R>
+        void fused_transform(const fused_transform_plan& plan, long ndim, const long nin[], const long nout[],
+                             const T* t, const Q* const pc[], R* restrict result, R* restrict workspace) {
+            R* w0 = workspace;
+            R* w1 = workspace + plan.scratch;
+            R* u = plan.inplace ? result : workspace + 2*plan.scratch;
+            const long nI = plan.nI, nJ = plan.nJ, nJout = plan.nJout, nIout = plan.nIout;
+
+            // The trailing dimensions, one slab of t at a time
+            for (long I=0; I<nI; ++I) {
+                transform_dims(nJ, plan.h, ndim, nin, nout, t+I*nJ, pc, w0, w1, u+I*nJout);
+            }
+
+            // The leading dimensions, one block of columns at a time.  The
+            // passes leave the columns first, so they are transposed back
+            // when the block is stored.
+            for (long j0=0; plan.h>0 && j0<nJout; j0+=plan.ncol) {
+                const long ncol = std::min(plan.ncol, nJout-j0);
+                for (long I=0; I<nI; ++I) {
+                    const R* restrict p = u + I*nJout + j0;
+                    R* restrict q = w0 + I*ncol;
+                    for (long j=0; j<ncol; ++j) q[j] = p[j];
+                }
+                const R* p = transform_dims(nI*ncol, 0, plan.h, nin, nout, w0, pc, w1, w0, (R*) 0);
+                for (long I=0; I<nIout; ++I) {
+                    R* restrict q = result + I*nJout + j0;
+                    for (long j=0; j<ncol; ++j) q[j] = p[j*nIout + I];
+                }
+            }
+        }
+    }
+
+
+    /// Transforms all dimensions of t with distinct matrices, in a single cache-blocked pass
+
+    /// \ingroup tensor
+    /// Computes the same as \c general_transform
+    /// \code
+    /// result(i,j,k...) <-- sum(i',j', k',...) t(i',j',k',...) c[0](i',i) c[1](j',j) c[2](k',k) ...
+    /// \endcode
+    /// but without streaming the whole tensor through memory once per
+    /// dimension, which dominates for large tensors (e.g., in 6D).  The
+    /// trailing dimensions are transformed one slab of \c t at a time and
+    /// the leading ones one block of columns at a time, with the slabs
+    /// and blocks sized so that their intermediates stay in cache.
+    /// Tensors that fit in cache as a whole are transformed as by \c
+    /// fast_transform.
+    ///
+    /// The matrices may be rectangular, e.g., the low-rank \c U or \c VT
+    /// factors of an operator: \c c[d] must be \c t.dim(d) by \c
+    /// result.dim(d).  All tensors must be contiguous, and \c result must
+    /// be distinct from \c t .  The workspace is reallocated if it is too
+    /// small, so it is cheapest to reuse one between calls; its contents
+    /// on input are ignored.
+    template <class T, class Q>
+    Tensor< TENSOR_RESULT_TYPE(T,Q) >& fused_transform(const Tensor<T>& t, const Tensor<Q> c[],
+            Tensor< TENSOR_RESULT_TYPE(T,Q) >& result, Tensor< TENSOR_RESULT_TYPE(T,Q) >& workspace) {
+        typedef TENSOR_RESULT_TYPE(T,Q) resultT;
+        const long ndim = t.ndim();
+        TENSOR_ASSERT(result.ndim() == ndim, "fused_transform: result has the wrong rank", result.ndim(), &result);
+        TENSOR_ASSERT(t.iscontiguous() && result.iscontiguous(), "fused_transform: tensors must be contiguous", 0, &t);
+
+        const Q* pc[TENSOR_MAXDIM];
+        long nin[TENSOR_MAXDIM], nout[TENSOR_MAXDIM];
+        for (long d=0; d<ndim; ++d) {
+            TENSOR_ASSERT(c[d].ndim()==2 && c[d].iscontiguous() && c[d].dim(0)==t.dim(d) && c[d].dim(1)==result.dim(d),
+                          "fused_transform: matrix does not match the tensors", d, &c[d]);
+            pc[d] = c[d].ptr();
+            nin[d] = t.dim(d);
+            nout[d] = result.dim(d);
+        }
+        const detail::fused_transform_plan plan(ndim, nin, nout, sizeof(resultT));
+        long size = plan.workspace();
+        if (workspace.size() < size) workspace = Tensor<resultT>(1, &size, false);
+        detail::fused_transform(plan, ndim, nin, nout, t.ptr(), pc, result.ptr(), workspace.ptr());
+        return result;
+    }
+
     /// Transform all dimensions of the tensor t by distinct matrices c
 
     /// \ingroup tensor
@@ -2317,10 +2468,23 @@ namespace madness {
     /// result(i,j,k...) <-- sum(i',j', k',...) t(i',j',k',...) c[0](i',i) c[1](j',j) c[2](k',k) ...
     /// \endcode
     /// The first dimension of the matrices c must match the corresponding
-    /// dimension of t.
+    /// dimension of t.  Contiguous tensors and matrices are transformed
+    /// by \c fused_transform .
     template <class T, class Q>
     Tensor<TENSOR_RESULT_TYPE(T,Q)> general_transform(const Tensor<T>& t, const Tensor<Q> c[]) {
         typedef TENSOR_RESULT_TYPE(T,Q) resultT;
+#if defined(AVX_MTXMQ_TEST) || (defined(X86_64) && !defined(DISABLE_SSE3))
+        bool fused = t.ndim()>0 && t.iscontiguous();
+        long dims[TENSOR_MAXDIM];
+        for (long i=0; fused && i<t.ndim(); ++i) {
+            fused = c[i].ndim()==2 && c[i].iscontiguous() && c[i].dim(0)==t.dim(i);
+            if (fused) dims[i] = c[i].dim(1);
+        }
+        if (fused) {
+            Tensor<resultT> result(t.ndim(), dims, false), workspace;
+            return fused_transform(t, c, result, workspace);
+        }
+#endif
         Tensor<resultT> result = t;
         for (long i=0; i<t.ndim(); ++i) {
             result = inner(result,c[i],0,0);
@@ -2344,9 +2508,9 @@ namespace madness {
     ///
     /// The input, result and workspace tensors must be distinct.
     ///
-    /// All input tensors must be contiguous and fastest execution
-    /// will result if all dimensions are even and data is aligned on
-    /// 16-byte boundaries.  The workspace and the result must be of
+    /// All input tensors must be contiguous.  Except on x86-64, fastest
+    /// execution will result if all dimensions are even and data is
+    /// aligned on 16-byte boundaries.  The workspace and the result must be of
     /// the same size as the input \c t .  The result tensor need not
     /// be initialized before calling fast_transform.
     ///
@@ -2355,6 +2519,10 @@ namespace madness {
     /// \endcode
     ///
     /// The input dimensions of \c t must all be the same .
+    ///
+    /// On x86-64, tensors too big for the cache (e.g., 6D with k>=8) are
+    /// transformed by the blocked passes of \c fused_transform if the
+    /// workspace is big enough for them.
     template <class T, class Q>
     Tensor< TENSOR_RESULT_TYPE(T,Q) >& fast_transform(const Tensor<T>& t, const Tensor<Q>& c,  Tensor< TENSOR_RESULT_TYPE(T,Q) >& result,
             Tensor< TENSOR_RESULT_TYPE(T,Q) >& workspace) {
@@ -2370,8 +2538,22 @@ namespace madness {
         long dimi = 1;
         for (int n=1; n<t.ndim(); ++n) dimi *= dimj;
 
-#ifdef AVX_MTXMQ_TEST
-        // The new AVX code is smokin' fast and has no restrictions
+#if defined(AVX_MTXMQ_TEST) || (defined(X86_64) && !defined(DISABLE_SSE3))
+        if (t.ndim() > 1) {
+            long n[TENSOR_MAXDIM];
+            const Q* pcs[TENSOR_MAXDIM];
+            for (int d=0; d<t.ndim(); ++d) {
+                n[d] = dimj;
+                pcs[d] = pc;
+            }
+            const detail::fused_transform_plan plan(t.ndim(), n, n, sizeof(resultT));
+            if (plan.h>0 && plan.workspace()<=workspace.size()) {
+                detail::fused_transform(plan, t.ndim(), n, n, t.ptr(), pcs, result.ptr(), workspace.ptr());
+                return result;
+            }
+        }
+
+        // On x86-64 mTxmq selects its kernel at runtime and has no restrictions
             mTxmq(dimi, dimj, dimj, t0, t.ptr(), pc);
             for (int n=1; n<t.ndim(); ++n) {
                 mTxmq(dimi, dimj, dimj, t1, t0, pc);
@@ -2419,6 +2601,29 @@ namespace madness {
         return result;
     }
 
+    /// Transforms all dimensions of each tensor of a batch by the same matrix
+
+    /// \ingroup tensor
+    /// Performs \c fast_transform on each of the \c n tensors \c t[i],
+    /// which must have the same dimensions, into \c result[i] with one
+    /// workspace for the whole batch.  Results that are empty are
+    /// allocated, and the workspace is reallocated if it is too small,
+    /// so that a caller with many small boxes (e.g., the two-scale
+    /// transforms of a level of a function) allocates only the results.
+    /// The requirements on \c t and \c c are those of \c fast_transform .
+    template <class T, class Q>
+    void fast_transform_batch(long n, const Tensor<T> t[], const Tensor<Q>& c, Tensor< TENSOR_RESULT_TYPE(T,Q) > result[],
+            Tensor< TENSOR_RESULT_TYPE(T,Q) >& workspace) {
+        typedef TENSOR_RESULT_TYPE(T,Q) resultT;
+        if (n == 0) return;
+        if (workspace.size() < t[0].size()) workspace = Tensor<resultT>(t[0].ndim(), t[0].dims(), false);
+        for (long i=0; i<n; ++i) {
+            TENSOR_ASSERT(t[i].conforms(t[0]), "fast_transform_batch: tensors differ in shape", i, &t[i]);
+            if (result[i].size() == 0) result[i] = Tensor<resultT>(t[i].ndim(), t[i].dims(), false);
+            fast_transform(t[i], c, result[i], workspace);
+        }
+    }
+
     /// Return a new tensor holding the absolute value of each element of t
 
     /// \ingroup tensor
@@ -61,6 +61,8 @@ template Tensor<TensorResultType<double,double>::type> inner(const Tensor<double
 template Tensor<TensorResultType<double,double>::type> transform(const Tensor<double>& t, const Tensor<double>& c);
 template Tensor<TensorResultType<double,double>::type> general_transform(const Tensor<double>& t, const Tensor<double> c[]);
 template Tensor<TensorResultType<double,double>::type>& fast_transform(const Tensor<double>& t, const Tensor<double>& c, Tensor< TensorResultType<double,double>::type >& result, Tensor< TensorResultType<double,double>::type >& work);
+template Tensor<TensorResultType<double,double>::type>& fused_transform(const Tensor<double>& t, const Tensor<double> c[], Tensor< TensorResultType<double,double>::type >& result, Tensor< TensorResultType<double,double>::type >& workspace);
+template void fast_transform_batch(long n, const Tensor<double> t[], const Tensor<double>& c, Tensor< TensorResultType<double,double>::type > result[], Tensor< TensorResultType<double,double>::type >& workspace);
 template void inner_result(const Tensor<float>& left, const Tensor<float>& right,
                            long k0, long k1, Tensor< TensorResultType<float,float>::type >& result);
 template Tensor<TensorResultType<float,float>::type> inner(const Tensor<float>& left, const Tensor<float>& right,
@@ -68,6 +70,8 @@ template Tensor<TensorResultType<float,float>::type> inner(const Tensor<float>&
 template Tensor<TensorResultType<float,float>::type> transform(const Tensor<float>& t, const Tensor<float>& c);
 template Tensor<TensorResultType<float,float>::type> general_transform(const Tensor<float>& t, const Tensor<float> c[]);
 template Tensor<TensorResultType<float,float>::type>& fast_transform(const Tensor<float>& t, const Tensor<float>& c, Tensor< TensorResultType<float,float>::type >& result, Tensor< TensorResultType<float,float>::type >& work);
+template Tensor<TensorResultType<float,float>::type>& fused_transform(const Tensor<float>& t, const Tensor<float> c[], Tensor< TensorResultType<float,float>::type >& result, Tensor< TensorResultType<float,float>::type >& workspace);
+template void fast_transform_batch(long n, const Tensor<float> t[], const Tensor<float>& c, Tensor< TensorResultType<float,float>::type > result[], Tensor< TensorResultType<float,float>::type >& workspace);
 template void inner_result(const Tensor<double_complex>& left, const Tensor<double_complex>& right,
                            long k0, long k1, Tensor< TensorResultType<double_complex,double_complex>::type >& result);
 template Tensor<TensorResultType<double_complex,double_complex>::type> inner(const Tensor<double_complex>& left, const Tensor<double_complex>& right,
@@ -75,6 +79,8 @@ template Tensor<TensorResultType<double_complex,double_complex>::type> inner(con
 template Tensor<TensorResultType<double_complex,double_complex>::type> transform(const Tensor<double_complex>& t, const Tensor<double_complex>& c);
 template Tensor<TensorResultType<double_complex,double_complex>::type> general_transform(const Tensor<double_complex>& t, const Tensor<double_complex> c[]);
 template Tensor<TensorResultType<double_complex,double_complex>::type>& fast_transform(const Tensor<double_complex>& t, const Tensor<double_complex>& c, Tensor< TensorResultType<double_complex,double_complex>::type >& result, Tensor< TensorResultType<double_complex,double_complex>::type >& work);
+template Tensor<TensorResultType<double_complex,double_complex>::type>& fused_transform(const Tensor<double_complex>& t, const Tensor<double_complex> c[], Tensor< TensorResultType<double_complex,double_complex>::type >& result, Tensor< TensorResultType<double_complex,double_complex>::type >& workspace);
+template void fast_transform_batch(long n, const Tensor<double_complex> t[], const Tensor<double_complex>& c, Tensor< TensorResultType<double_complex,double_complex>::type > result[], Tensor< TensorResultType<double_complex,double_complex>::type >& workspace);
 template void inner_result(const Tensor<float_complex>& left, const Tensor<float_complex>& right,
                            long k0, long k1, Tensor< TensorResultType<float_complex,float_complex>::type >& result);
 template Tensor<TensorResultType<float_complex,float_complex>::type> inner(const Tensor<float_complex>& left, const Tensor<float_complex>& right,
@@ -82,6 +88,8 @@ template Tensor<TensorResultType<float_complex,float_complex>::type> inner(const
 template Tensor<TensorResultType<float_complex,float_complex>::type> transform(const Tensor<float_complex>& t, const Tensor<float_complex>& c);
 template Tensor<TensorResultType<float_complex,float_complex>::type> general_transform(const Tensor<float_complex>& t, const Tensor<float_complex> c[]);
 template Tensor<TensorResultType<float_complex,float_complex>::type>& fast_transform(const Tensor<float_complex>& t, const Tensor<float_complex>& c, Tensor< TensorResultType<float_complex,float_complex>::type >& result, Tensor< TensorResultType<float_complex,float_complex>::type >& work);
+template Tensor<TensorResultType<float_complex,float_complex>::type>& fused_transform(const Tensor<float_complex>& t, const Tensor<float_complex> c[], Tensor< TensorResultType<float_complex,float_complex>::type >& result, Tensor< TensorResultType<float_complex,float_complex>::type >& workspace);
+template void fast_transform_batch(long n, const Tensor<float_complex> t[], const Tensor<float_complex>& c, Tensor< TensorResultType<float_complex,float_complex>::type > result[], Tensor< TensorResultType<float_complex,float_complex>::type >& workspace);
 template void inner_result(const Tensor<double_complex>& left, const Tensor<double>& right,
                            long k0, long k1, Tensor< TensorResultType<double_complex,double>::type >& result);
 template Tensor<TensorResultType<double_complex,double>::type> inner(const Tensor<double_complex>& left, const Tensor<double>& right,
@@ -89,6 +97,8 @@ template Tensor<TensorResultType<double_complex,double>::type> inner(const Tenso
 template Tensor<TensorResultType<double_complex,double>::type> transform(const Tensor<double_complex>& t, const Tensor<double>& c);
 template Tensor<TensorResultType<double_complex,double>::type> general_transform(const Tensor<double_complex>& t, const Tensor<double> c[]);
 template Tensor<TensorResultType<double_complex,double>::type>& fast_transform(const Tensor<double_complex>& t, const Tensor<double>& c, Tensor< TensorResultType<double_complex,double>::type >& result, Tensor< TensorResultType<double_complex,double>::type >& work);
+template Tensor<TensorResultType<double_complex,double>::type>& fused_transform(const Tensor<double_complex>& t, const Tensor<double> c[], Tensor< TensorResultType<double_complex,double>::type >& result, Tensor< TensorResultType<double_complex,double>::type >& workspace);
+template void fast_transform_batch(long n, const Tensor<double_complex> t[], const Tensor<double>& c, Tensor< TensorResultType<double_complex,double>::type > result[], Tensor< TensorResultType<double_complex,double>::type >& workspace);
 template void inner_result(const Tensor<double>& left, const Tensor<double_complex>& right,
                            long k0, long k1, Tensor< TensorResultType<double,double_complex>::type >& result);
 template Tensor<TensorResultType<double,double_complex>::type> inner(const Tensor<double>& left, const Tensor<double_complex>& right,
@@ -96,6 +106,8 @@ template Tensor<TensorResultType<double,double_complex>::type> inner(const Tenso
 template Tensor<TensorResultType<double,double_complex>::type> transform(const Tensor<double>& t, const Tensor<double_complex>& c);
 template Tensor<TensorResultType<double,double_complex>::type> general_transform(const Tensor<double>& t, const Tensor<double_complex> c[]);
 template Tensor<TensorResultType<double,double_complex>::type>& fast_transform(const Tensor<double>& t, const Tensor<double_complex>& c, Tensor< TensorResultType<double,double_complex>::type >& result, Tensor< TensorResultType<double,double_complex>::type >& work);
+template Tensor<TensorResultType<double,double_complex>::type>& fused_transform(const Tensor<double>& t, const Tensor<double_complex> c[], Tensor< TensorResultType<double,double_complex>::type >& result, Tensor< TensorResultType<double,double_complex>::type >& workspace);
+template void fast_transform_batch(long n, const Tensor<double> t[], const Tensor<double_complex>& c, Tensor< TensorResultType<double,double_complex>::type > result[], Tensor< TensorResultType<double,double_complex>::type >& workspace);
 template void inner_result(const Tensor<float_complex>& left, const Tensor<float>& right,
                            long k0, long k1, Tensor< TensorResultType<float_complex,float>::type >& result);
 template Tensor<TensorResultType<float_complex,float>::type> inner(const Tensor<float_complex>& left, const Tensor<float>& right,
@@ -103,6 +115,8 @@ template Tensor<TensorResultType<float_complex,float>::type> inner(const Tensor<
 template Tensor<TensorResultType<float_complex,float>::type> transform(const Tensor<float_complex>& t, const Tensor<float>& c);
 template Tensor<TensorResultType<float_complex,float>::type> general_transform(const Tensor<float_complex>& t, const Tensor<float> c[]);
 template Tensor<TensorResultType<float_complex,float>::type>& fast_transform(const Tensor<float_complex>& t, const Tensor<float>& c, Tensor< TensorResultType<float_complex,float>::type >& result, Tensor< TensorResultType<float_complex,float>::type >& work);
+template Tensor<TensorResultType<float_complex,float>::type>& fused_transform(const Tensor<float_complex>& t, const Tensor<float> c[], Tensor< TensorResultType<float_complex,float>::type >& result, Tensor< TensorResultType<float_complex,float>::type >& workspace);
+template void fast_transform_batch(long n, const Tensor<float_complex> t[], const Tensor<float>& c, Tensor< TensorResultType<float_complex,float>::type > result[], Tensor< TensorResultType<float_complex,float>::type >& workspace);
 template void inner_result(const Tensor<float>& left, const Tensor<float_complex>& right,
                            long k0, long k1, Tensor< TensorResultType<float,float_complex>::type >& result);
 template Tensor<TensorResultType<float,float_complex>::type> inner(const Tensor<float>& left, const Tensor<float_complex>& right,
@@ -110,6 +124,8 @@ template Tensor<TensorResultType<float,float_complex>::type> inner(const Tensor<
 template Tensor<TensorResultType<float,float_complex>::type> transform(const Tensor<float>& t, const Tensor<float_complex>& c);
 template Tensor<TensorResultType<float,float_complex>::type> general_transform(const Tensor<float>& t, const Tensor<float_complex> c[]);
 template Tensor<TensorResultType<float,float_complex>::type>& fast_transform(const Tensor<float>& t, const Tensor<float_complex>& c, Tensor< TensorResultType<float,float_complex>::type >& result, Tensor< TensorResultType<float,float_complex>::type >& work);
+template Tensor<TensorResultType<float,float_complex>::type>& fused_transform(const Tensor<float>& t, const Tensor<float_complex> c[], Tensor< TensorResultType<float,float_complex>::type >& result, Tensor< TensorResultType<float,float_complex>::type >& workspace);
+template void fast_transform_batch(long n, const Tensor<float> t[], const Tensor<float_complex>& c, Tensor< TensorResultType<float,float_complex>::type > result[], Tensor< TensorResultType<float,float_complex>::type >& workspace);
 
 // Instantiations only for complex types
 
@@ -426,6 +426,49 @@ namespace {
     	}
     }
 
+    // sum of many low-rank terms with a low-rank result, as in the accumulation
+    // of the separated terms of an integral operator
+    TEST(GenTensorReduceTest, Randomized) {
+    	const long k=6, r=4, nterm=40;
+    	const double eps=1.e-4;
+    	const std::vector<long> dim(6,k);
+
+    	// a few base configurations, each term is one of them with random weights
+    	std::vector<Tensor<double> > x(3), y(3);
+    	for (int i=0; i<3; ++i) {
+    		x[i]=Tensor<double>(r,k*k*k).fillrandom();
+    		y[i]=Tensor<double>(r,k*k*k).fillrandom();
+    	}
+
+    	std::list<GenTensor<double> > terms, terms_ref;
+    	Tensor<double> sum(dim);
+    	for (int i=0; i<nterm; ++i) {
+    		Tensor<double> w(r);
+    		w.fillrandom();
+    		GenTensor<double> g(SRConf<double>(w,copy(x[i%3]),copy(y[i%3]),6,k));
+    		sum+=g.full_tensor_copy();
+    		terms.push_back(g);
+    		terms_ref.push_back(copy(g));
+    	}
+
+    	// one term in the leading block only, like the sum coefficients in NS form
+    	const std::vector<Slice> s(6,Slice(0,k/2-1));
+    	Tensor<double> t0=prep_tensor<double>(std::vector<long>(6,k/2),index);
+    	GenTensor<double> g0(t0,TensorArgs(eps*0.01,TT_2D));
+    	sum(s)+=t0;
+    	terms.push_back(g0);
+
+    	GenTensor<double> result=reduce_randomized(terms,eps);
+    	EXPECT_EQ(terms.size(),0);
+    	EXPECT_LE(result.rank(),3*r+g0.rank());
+    	EXPECT_LT((result.full_tensor_copy()-sum).normf(),eps);
+
+    	// same as reduce
+    	GenTensor<double> ref=reduce(terms_ref,eps);
+    	ref(s)+=g0;
+    	EXPECT_LT((result.full_tensor_copy()-ref.full_tensor_copy()).normf(),eps);
+    }
+
     // let's keep construction as a typed test so that at least compiling will always work
     typedef ::testing::Types<float, double, float_complex, double_complex> GenTensorTestTypes;
     TYPED_TEST_CASE(GenTensorTest, GenTensorTestTypes);
@@ -33,8 +33,7 @@
 
 #include <madness/madness_config.h>
 
-// Disable for now to facilitate CI 
-#if !(defined(X86_32X) || defined(X86_64X))
+#if !(defined(X86_32) || defined(X86_64))
 
 #include <iostream>
 int main() {std::cout << "x86 only\n"; return 0;}
@@ -55,15 +54,6 @@ int main() {std::cout << "x86 only\n"; return 0;}
 using namespace madness;
 
 
-#ifdef TIME_DGEMM
-
-void mTxm_dgemm(long ni, long nj, long nk, double* c, const double* a, const double*b ) {
-  double one=1.0;
-  cblas::gemm(cblas::NoTrans,cblas::Trans,nj,ni,nk,one,b,nj,a,ni,one,c,nj);
-}
-
-#endif
-
 double ran()
 {
   static unsigned long seed = 76521;
@@ -89,140 +79,59 @@ void mTxm(long dimi, long dimj, long dimk,
     }
 }
 
-void crap(double rate, double fastest, double start) {
-    if (rate == 0) printf("darn compiler bug %e %e %lf\n",rate,fastest,start);
-}
-
-
-void timer(const char* s, long ni, long nj, long nk, double *a, double *b, double *c) {
-  double fastest=0.0, fastest_dgemm=0.0;
-
-  double nflop = 2.0*ni*nj*nk;
-  long loop;
-  for (int t=0; t<100; t++) {
-    double rate;
-    double start = SafeMPI::Wtime();
-    for (loop=0; loop<100; ++loop) {
-      mTxmq(ni,nj,nk,c,a,b);
-    }
-    start = SafeMPI::Wtime() - start;
-    rate = 1.e-9*nflop/(start/100.0);
-    crap(rate,fastest,start);
-    if (rate > fastest) fastest = rate;
-  }
-#ifdef TIME_DGEMM
-  for (int t=0; t<100; t++) {
-    double rate;
-    double start = SafeMPI::Wtime();
-    for (loop=0; loop<100; ++loop) {
-      mTxm_dgemm(ni,nj,nk,c,a,b);
-    }
-    start = SafeMPI::Wtime() - start;
-    rate = 1.e-9*nflop/(start/100.0);
-    crap(rate,fastest_dgemm,start);
-    if (rate > fastest_dgemm) fastest_dgemm = rate;
-  }
-#endif
-  printf("%20s %3ld %3ld %3ld %8.2f %8.2f\n",s, ni,nj,nk, fastest, fastest_dgemm);
-}
-
-void trantimer(const char* s, long ni, long nj, long nk, double *a, double *b, double *c) {
-  double fastest=0.0, fastest_dgemm=0.0;
-
-  double nflop = 3.0*2.0*ni*nj*nk;
-  long loop;
-  for (int t=0; t<100; t++) {
-    double rate;
-    double start = SafeMPI::Wtime();
-    for (loop=0; loop<100; ++loop) {
-      mTxmq(ni,nj,nk,c,a,b);
-      mTxmq(ni,nj,nk,a,c,b);
-      mTxmq(ni,nj,nk,c,a,b);
-    }
-    start = SafeMPI::Wtime() - start;
-    rate = 1.e-9*nflop/(start/100.0);
-    crap(rate,fastest,start);
-    if (rate > fastest) fastest = rate;
-  }
-#ifdef TIME_DGEMM
-  for (int t=0; t<100; t++) {
-    double rate;
-    double start = SafeMPI::Wtime();
-    for (loop=0; loop<100; ++loop) {
-      mTxm_dgemm(ni,nj,nk,c,a,b);
-      mTxm_dgemm(ni,nj,nk,a,c,b);
-      mTxm_dgemm(ni,nj,nk,c,a,b);
-    }
-    start = SafeMPI::Wtime() - start;
-    rate = 1.e-9*nflop/(start/100.0);
-    crap(rate,fastest_dgemm,start);
-    if (rate > fastest_dgemm) fastest_dgemm = rate;
-  }
-#endif
-  printf("%20s %3ld %3ld %3ld %8.2f %8.2f\n",s, ni,nj,nk, fastest, fastest_dgemm);
-}
-
 int main(int argc, char * argv[]) {
-    const long nimax=30*30;
-    const long njmax=100;
-    const long nkmax=100;
-    long ni, nj, nk, i, m;
-    double *a, *b, *c, *d;
+    const long nmax=30;
+    long ni, nj, nk, i;
+    double *abuf, *bbuf, *c, *dbuf;
 
     SafeMPI::Init_thread(argc, argv, MPI_THREAD_SINGLE);
 
-    posix_memalign((void **) &a, 16, nkmax*nimax*sizeof(double));
-    posix_memalign((void **) &b, 16, nkmax*njmax*sizeof(double));
-    posix_memalign((void **) &c, 16, nimax*njmax*sizeof(double));
-    posix_memalign((void **) &d, 16, nimax*njmax*sizeof(double));
-
-    ran_fill(nkmax*nimax, a);
-    ran_fill(nkmax*njmax, b);
+    posix_memalign((void **) &abuf, 16, (nmax*nmax+1)*sizeof(double));
+    posix_memalign((void **) &bbuf, 16, (nmax*nmax+1)*sizeof(double));
+    posix_memalign((void **) &c, 16, nmax*nmax*sizeof(double));
+    posix_memalign((void **) &dbuf, 16, (nmax*nmax+1)*sizeof(double));
 
+    ran_fill(nmax*nmax+1, abuf);
+    ran_fill(nmax*nmax+1, bbuf);
 
-/*     ni = nj = nk = 2; */
-/*     for (i=0; i<ni*nj; ++i) d[i] = c[i] = 0.0; */
-/*     mTxm (ni,nj,nk,c,a,b); */
-/*     mTxmq(ni,nj,nk,d,a,b); */
-/*     for (i=0; i<ni; ++i) { */
-/*       long j; */
-/*       for (j=0; j<nj; ++j) { */
-/* 	printf("%2ld %2ld %.6f %.6f\n", i, j, c[i*nj+j], d[i*nj+j]); */
-/*       } */
-/*     } */
-/*     return 0; */
-
+    // Every kernel the host supports, for all shapes and for aligned
+    // and misaligned data.  Timings are reported by bench_mtxmq.
     printf("Starting to test ... \n");
-    for (ni=1; ni<60; ni+=1) {
-        for (nj=1; nj<100; nj+=1) {
-            for (nk=1; nk<100; nk+=1) {
-                for (i=0; i<ni*nj; ++i) d[i] = c[i] = 0.0;
-                mTxm (ni,nj,nk,c,a,b);
-                mTxmq(ni,nj,nk,d,a,b);
-                for (i=0; i<ni*nj; ++i) {
-                    double err = std::abs(d[i]-c[i]);
-                    /* This test is sensitive to the compilation options.
-                       Be sure to have the reference code above compiled
-                       -msse2 -fpmath=sse if using GCC.  Otherwise, to
-                       pass the test you may need to change the threshold
-                       to circa 1e-13.
-                    */
-                    if (err > 1e-13) {
-                        printf("test_mtxmq: error %ld %ld %ld %e\n",ni,nj,nk,err);
-                        exit(1);
+    const mTxmqISA best = mTxmq_isa();
+    for (int isa=MTXMQ_GENERIC; isa<=best; ++isa) {
+        if (set_mTxmq_isa(mTxmqISA(isa)) != isa) continue;
+        printf("   %s\n", mTxmq_isa_name(mTxmqISA(isa)));
+        for (long off=0; off<2; ++off) {
+            const double *a = abuf+off, *b = bbuf+off;
+            double *d = dbuf+off;
+            for (ni=1; ni<nmax; ni+=1) {
+                for (nj=1; nj<nmax; nj+=1) {
+                    for (nk=1; nk<nmax; nk+=1) {
+                        for (i=0; i<ni*nj; ++i) d[i] = c[i] = 0.0;
+                        mTxm (ni,nj,nk,c,a,b);
+                        mTxmq(ni,nj,nk,d,a,b);
+                        for (i=0; i<ni*nj; ++i) {
+                            double err = std::abs(d[i]-c[i]);
+                            /* This test is sensitive to the compilation options.
+                               Be sure to have the reference code above compiled
+                               -msse2 -fpmath=sse if using GCC.  Otherwise, to
+                               pass the test you may need to change the threshold
+                               to circa 1e-13.
+                            */
+                            if (err > 1e-13) {
+                                printf("test_mtxmq: error %s %ld %ld %ld %ld %e\n",
+                                       mTxmq_isa_name(mTxmqISA(isa)),ni,nj,nk,off,err);
+                                exit(1);
+                            }
+                        }
                     }
                 }
             }
         }
     }
+    set_mTxmq_isa(best);
     printf("... OK!\n");
 
-    printf("%20s %3s %3s %3s %8s %8s (GF/s)\n", "type", "M", "N", "K", "LOOP", "BLAS");
-    for (ni=2; ni<60; ni+=2) timer("(m*m)T*(m*m)", ni,ni,ni,a,b,c);
-    for (m=2; m<=30; m+=2) timer("(m*m,m)T*(m*m)", m*m,m,m,a,b,c);
-    for (m=2; m<=30; m+=2) trantimer("tran(m,m,m)", m*m,m,m,a,b,c);
-    for (m=2; m<=20; m+=2) timer("(20*20,20)T*(20,m)", 20*20,m,20,a,b,c);
-
     SafeMPI::Finalize();
 
     return 0;